@@ -0,0 +1,90 @@
+// C++17: plain aggregates are serialized without serialization_sequential(...)
+#include <string>
+#include <vector>
+#include <iostream>
+#include "../include/Seiriakos.hpp"
+#include "../include/Chronometro.hpp"
+
+struct Header
+{
+  uint32_t sequence;
+  uint16_t kind;
+  uint16_t flags;
+  uint64_t timestamp;
+};
+
+struct Trade
+{
+  Header      header;
+  std::string symbol;
+  double      price;
+  uint32_t    quantity;
+};
+
+struct Quote
+{
+  uint32_t instrument;
+  char     symbol[12];
+};
+
+struct Fill : Header
+{
+  uint32_t order;
+  uint32_t quantity;
+};
+
+struct Venue
+{
+  std::string name;
+  Quote       best[2];
+};
+
+struct Batch
+{
+  std::vector<Header> heartbeats;
+  std::vector<Trade>  trades;
+  std::vector<Quote>  quotes;
+  std::vector<Fill>   fills;
+  Venue               venue;
+};
+
+int main()
+{
+  Batch batch;
+
+  for (uint32_t k = 0; k < 1000; ++k)
+  {
+    batch.heartbeats.push_back(Header{k, 0, 0, 1000000 + k});
+    batch.trades.push_back(Trade{Header{k, 1, 0, 2000000 + k}, "STZ", 12.5 + k, 100 * k});
+    batch.quotes.push_back(Quote{k, "STZ"});
+    batch.fills.push_back(Fill{{k, 2, 0, 3000000 + k}, k, 10 * k});
+  }
+
+  batch.venue = Venue{"XSTZ", {Quote{1, "BID"}, Quote{2, "ASK"}}};
+
+  stz::Bytes binary;
+  Batch      copy;
+
+  // Header is trivially copyable and has no padding: bulk copied, stz::static_size<Header>::value == sizeof(Header)
+  // Quote's C array and Fill's base class are bulk copied as well
+  // Trade holds a std::string: its fields are serialized one by one
+  // Venue holds a std::string and a C array of Quote: its fields are serialized one by one, the array in one go
+  stz::measure_block(1000, "", "serialize:   %ms [avg = %Dus]")
+  {
+    binary = stz::serialize(batch);
+  };
+
+  stz::measure_block(1000, "", "deserialize: %ms [avg = %Dus]")
+  {
+    stz::deserialize(binary.data(), binary.size(), copy);
+  };
+
+  std::cout << "static size of Header: " << stz::static_size<Header>::value << '\n';
+  std::cout << "static size of Quote:  " << stz::static_size<Quote>::value << '\n';
+  std::cout << "static size of Fill:   " << stz::static_size<Fill>::value << '\n';
+  std::cout << "last trade:            " << copy.trades.back().symbol << " x" << copy.trades.back().quantity << '\n';
+  std::cout << "last fill:             " << copy.fills.back().order << " x" << copy.fills.back().quantity << '\n';
+  std::cout << "venue:                 " << copy.venue.name << ' ' << copy.venue.best[0].symbol << '/'
+                                         << copy.venue.best[1].symbol << '\n';
+  std::cout << "byte count:            " << binary.size() << '\n';
+}
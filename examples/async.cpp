@@ -0,0 +1,66 @@
+// C++20: serialize_async(...) produces the next window of bytes only once the previous one was consumed
+#include <map>
+#include <string>
+#include <cstdint>
+#include <iostream>
+#include "../include/Seiriakos.hpp"
+
+struct Session
+{
+  uint64_t              id;
+  std::string           user;
+  std::vector<uint32_t> history;
+
+  stz::serialization_sequential(id, user, history)
+};
+
+// a procedural block is run again at each resume, it pauses within 'sessions' as it would within the map alone
+struct Archive
+{
+  uint32_t                    format = 2;
+  std::map<uint64_t, Session> sessions;
+
+  stz::serialization_procedural(
+    serializer.version = 1;
+    serializer <= format, sessions;
+  )
+};
+
+// stands in for a socket accepting at most one window per write, the peer keeps what it received
+struct Socket
+{
+  size_t     writes = 0;
+  size_t     widest = 0;
+  stz::Bytes received;
+
+  void write(const stz::Bytes& chunk_)
+  {
+    ++writes;
+    widest = std::max(widest, chunk_.size());
+    received.insert(received.end(), chunk_.begin(), chunk_.end());
+  }
+};
+
+int main()
+{
+  Archive archive;
+  std::map<uint64_t, Session>& sessions = archive.sessions;
+
+  for (uint64_t k = 0; k < 100000; ++k)
+  {
+    sessions[k] = Session{k, "user #" + std::to_string(k), std::vector<uint32_t>(k % 32, 7)};
+  }
+
+  Socket socket;
+
+  // no more than a window and the element being serialized are held at once
+  for (const stz::Bytes& chunk : stz::serialize_async(archive, 4096))
+  {
+    socket.write(chunk);
+  }
+
+  std::cout << "writes:          " << socket.writes << '\n';
+  std::cout << "widest write:    " << socket.widest << '\n';
+  std::cout << "byte count:      " << socket.received.size() << '\n';
+  std::cout << "same bytes as serialize(...): " << (socket.received == stz::serialize(archive) ? "yes" : "no") << '\n';
+}
@@ -0,0 +1,506 @@
+// runtime: run the executable, optionally with the largest element count to try (default: 1048576)
+// prints CSV on the standard output, one row per container, element type, size and direction
+// with STZ_STATS (target bench_stats), also the allocations of a warm round-trip; --check fails on any unexpected one
+#include <map>
+#include <set>
+#include <list>
+#include <array>
+#include <deque>
+#include <queue>
+#include <stack>
+#include <tuple>
+#include <bitset>
+#include <memory>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <valarray>
+#include <iostream>
+#include <forward_list>
+#include <unordered_map>
+#include <unordered_set>
+#if __cplusplus >= 201703L
+#include <optional>
+#include <variant>
+#endif
+#include "../include/Seiriakos.hpp"
+#include "../include/Chronometro.hpp"
+
+// std::priority_queue, see the disclosure of Seiriakos.hpp
+#if defined(__GNUC__) and not defined(__clang__)
+# pragma GCC diagnostic ignored "-Wstrict-overflow"
+#endif
+
+struct Point
+{
+  uint32_t id;
+  float    x;
+  float    y;
+
+  bool operator==(const Point& other_) const { return id == other_.id; }
+  bool operator<(const Point& other_)  const { return id <  other_.id; }
+
+  stz::serialization_sequential(id, x, y)
+};
+
+namespace std
+{
+  template<>
+  struct hash<Point>
+  {
+    size_t operator()(const Point& point_) const noexcept { return point_.id; }
+  };
+}
+
+// element k of every container, keys are distinct
+template<typename T>
+struct Make
+{
+  static T at(const uint32_t k_) { return static_cast<T>(k_); }
+};
+
+template<>
+struct Make<Point>
+{
+  static Point at(const uint32_t k_) { return Point{k_, 0.5f * static_cast<float>(k_), 0.25f * static_cast<float>(k_)}; }
+};
+
+template<>
+struct Make<bool>
+{
+  static bool at(const uint32_t k_) { return (k_ % 3) == 0; }
+};
+
+template<typename K, typename V>
+struct Make<std::pair<const K, V>>
+{
+  static std::pair<const K, V> at(const uint32_t k_) { return {Make<K>::at(k_), Make<V>::at(k_)}; }
+};
+
+template<typename T1, typename T2>
+struct Make<std::pair<T1, T2>>
+{
+  static std::pair<T1, T2> at(const uint32_t k_) { return {Make<T1>::at(k_), Make<T2>::at(k_)}; }
+};
+
+template<typename... T>
+struct Make<std::tuple<T...>>
+{
+  static std::tuple<T...> at(const uint32_t k_) { return std::tuple<T...>(Make<T>::at(k_)...); }
+};
+
+template<typename T>
+struct Make<std::unique_ptr<T>>
+{
+  static std::unique_ptr<T> at(const uint32_t k_) { return std::unique_ptr<T>(new T(Make<T>::at(k_))); }
+};
+
+template<typename T>
+struct Make<std::shared_ptr<T>>
+{
+  static std::shared_ptr<T> at(const uint32_t k_) { return std::make_shared<T>(Make<T>::at(k_)); }
+};
+
+#if __cplusplus >= 201703L
+// one element in four is empty
+template<typename T>
+struct Make<std::optional<T>>
+{
+  static std::optional<T> at(const uint32_t k_) { return (k_ % 4) ? std::optional<T>(Make<T>::at(k_)) : std::nullopt; }
+};
+
+// alternates between the two alternatives
+template<typename T1, typename T2>
+struct Make<std::variant<T1, T2>>
+{
+  static std::variant<T1, T2> at(const uint32_t k_)
+  {
+    return (k_ % 2) ? std::variant<T1, T2>(Make<T1>::at(k_)) : std::variant<T1, T2>(Make<T2>::at(k_));
+  }
+};
+#endif
+
+// container of 'size_' elements, element k being Make<element>::at(k)
+template<typename C>
+struct Fill
+{
+  static C with(const size_t size_)
+  {
+    C container;
+    for (uint32_t k = 0; k < size_; ++k)
+    {
+      container.insert(container.end(), Make<typename C::value_type>::at(k));
+    }
+
+    return container;
+  }
+};
+
+template<typename T>
+struct Fill<std::forward_list<T>>
+{
+  static std::forward_list<T> with(const size_t size_)
+  {
+    std::forward_list<T> container;
+    auto last = container.before_begin();
+    for (uint32_t k = 0; k < size_; ++k)
+    {
+      last = container.insert_after(last, Make<T>::at(k));
+    }
+
+    return container;
+  }
+};
+
+// fixed-size containers are only benchmarked at their own size
+template<typename T, size_t N>
+struct Fill<std::array<T, N>>
+{
+  static std::array<T, N> with(size_t)
+  {
+    std::array<T, N> container = {};
+    for (uint32_t k = 0; k < N; ++k)
+    {
+      container[k] = Make<T>::at(k);
+    }
+
+    return container;
+  }
+};
+
+template<size_t N>
+struct Fill<std::bitset<N>>
+{
+  static std::bitset<N> with(size_t)
+  {
+    std::bitset<N> container;
+    for (uint32_t k = 0; k < N; ++k)
+    {
+      container[k] = Make<bool>::at(k);
+    }
+
+    return container;
+  }
+};
+
+template<typename T>
+struct Fill<std::valarray<T>>
+{
+  static std::valarray<T> with(const size_t size_)
+  {
+    std::valarray<T> container(size_);
+    for (uint32_t k = 0; k < size_; ++k)
+    {
+      container[k] = Make<T>::at(k);
+    }
+
+    return container;
+  }
+};
+
+// the adaptors are filled through push(...)
+template<typename A>
+struct Fill_adaptor
+{
+  static A with(const size_t size_)
+  {
+    A container;
+    for (uint32_t k = 0; k < size_; ++k)
+    {
+      container.push(Make<typename A::value_type>::at(k));
+    }
+
+    return container;
+  }
+};
+
+template<typename T>
+struct Fill<std::stack<T>> : Fill_adaptor<std::stack<T>> {};
+
+template<typename T>
+struct Fill<std::queue<T>> : Fill_adaptor<std::queue<T>> {};
+
+template<typename T>
+struct Fill<std::priority_queue<T>> : Fill_adaptor<std::priority_queue<T>> {};
+
+template<typename C>
+C make(const size_t size_)
+{
+  return Fill<C>::with(size_);
+}
+
+// whether a round-trip gave back the original, for the types whose == does not say so
+template<typename C>
+bool same(const C& lhs_, const C& rhs_)
+{
+  return lhs_ == rhs_;
+}
+
+template<typename T>
+bool same(const std::valarray<T>& lhs_, const std::valarray<T>& rhs_)
+{
+  return (lhs_.size() == rhs_.size()) and ((lhs_.size() == 0) or (lhs_ == rhs_).min());
+}
+
+template<typename T>
+bool same(std::priority_queue<T> lhs_, std::priority_queue<T> rhs_)
+{
+  for (; not lhs_.empty() and not rhs_.empty(); lhs_.pop(), rhs_.pop())
+  {
+    if (lhs_.top() != rhs_.top()) return false;
+  }
+
+  return lhs_.empty() and rhs_.empty();
+}
+
+// pointees are compared, not the pointers
+template<typename P>
+bool same_pointees(const std::vector<P>& lhs_, const std::vector<P>& rhs_)
+{
+  if (lhs_.size() != rhs_.size()) return false;
+
+  for (size_t k = 0; k < lhs_.size(); ++k)
+  {
+    if ((lhs_[k] == nullptr) != (rhs_[k] == nullptr)) return false;
+    if (lhs_[k] and not (*lhs_[k] == *rhs_[k]))      return false;
+  }
+
+  return true;
+}
+
+template<typename T>
+bool same(const std::vector<std::unique_ptr<T>>& lhs_, const std::vector<std::unique_ptr<T>>& rhs_)
+{
+  return same_pointees(lhs_, rhs_);
+}
+
+template<typename T>
+bool same(const std::vector<std::shared_ptr<T>>& lhs_, const std::vector<std::shared_ptr<T>>& rhs_)
+{
+  return same_pointees(lhs_, rhs_);
+}
+
+#if defined(STZ_STATS)
+template<typename...>
+struct Void { using type = void; };
+
+// containers rebuilt on every load: one node per element is expected even when warm
+template<typename C, typename = void>
+struct Rebuilt : std::false_type {};
+
+template<typename C>
+struct Rebuilt<C, typename Void<typename C::key_type>::type> : std::true_type {};
+
+// as are the pointees
+template<typename T>
+struct Rebuilt<std::vector<std::unique_ptr<T>>> : std::true_type {};
+
+template<typename T>
+struct Rebuilt<std::vector<std::shared_ptr<T>>> : std::true_type {};
+
+static bool regressions = false;
+#endif
+
+// enough iterations for the clock to be meaningful, few enough for the largest sizes to finish in time
+unsigned iterations_for(const size_t size_)
+{
+  return static_cast<unsigned>(std::max<size_t>(3, std::min<size_t>(100000, (size_t(1) << 21) / std::max<size_t>(1, size_))));
+}
+
+// ns per iteration of 'statements'
+template<typename F>
+double time_per_iteration(const unsigned iterations_, F&& statements_)
+{
+  stz::Stopwatch stopwatch;
+  stopwatch.reset();
+
+  for (unsigned k = 0; k < iterations_; ++k)
+  {
+    statements_();
+  }
+
+  return static_cast<double>(stopwatch.total().nanoseconds.count()) / iterations_;
+}
+
+void report(const char* const container_, const char* const element_, const size_t size_, const char* const direction_,
+  const size_t bytes_, const double ns_, const double memcpy_ns_, const stz::Stats& stats_)
+{
+  // MB/s of the serialized bytes, so that every direction and container is compared with memcpy on the same footing
+  const double mb_per_s        = bytes_ ? (1e3 * static_cast<double>(bytes_) / ns_)        : 0;
+  const double memcpy_mb_per_s = bytes_ ? (1e3 * static_cast<double>(bytes_) / memcpy_ns_) : 0;
+
+  std::cout << container_ << ',' << element_ << ',' << size_ << ',' << direction_ << ',' << bytes_ << ',' << ns_ << ',';
+
+  if (size_) std::cout << ns_ / static_cast<double>(size_);
+
+  std::cout << ',' << mb_per_s << ',' << memcpy_mb_per_s << ',';
+
+  if (bytes_) std::cout << ns_ / memcpy_ns_;
+
+#if defined(STZ_STATS)
+  std::cout << ',' << stats_.container_allocations + stats_.pointee_allocations << ',' << stats_.buffer_regrowths;
+#else
+  (void)stats_;
+#endif
+
+  std::cout << '\n';
+}
+
+template<typename C>
+void benchmark(const char* const container_, const char* const element_, const size_t size_)
+{
+  const unsigned iterations = iterations_for(size_);
+
+  const C    original = make<C>(size_);
+  stz::Bytes binary   = stz::serialize(original);
+  C          copy;
+
+  const auto srz = [&]
+  {
+    binary = stz::serialize(original);
+  };
+
+  const auto drz = [&]
+  {
+    stz::deserialize(binary.data(), binary.size(), copy);
+  };
+
+  const double srz_ns = time_per_iteration(iterations, srz);
+  const double drz_ns = time_per_iteration(iterations, drz);
+
+  if (not same(copy, original))
+  {
+    std::cerr << container_ << '<' << element_ << "> of " << size_ << " elements: round-trip mismatch\n";
+  }
+
+  // baseline: copying the serialized bytes from one buffer to another
+  stz::Bytes destination(binary.size());
+  const double memcpy_ns = time_per_iteration(iterations, [&]
+  {
+    std::memcpy(destination.data(), binary.data(), binary.size());
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+  });
+
+  // one more warm round-trip, counted on its own
+  stz::stats() = {};
+  srz();
+  const stz::Stats srz_stats = stz::stats();
+
+  stz::stats() = {};
+  drz();
+  const stz::Stats drz_stats = stz::stats();
+
+#if defined(STZ_STATS)
+  const size_t expected = Rebuilt<C>::value ? size_ : 0;
+
+  if ((srz_stats.buffer_regrowths != 0) or (drz_stats.buffer_regrowths != 0) or
+      (drz_stats.container_allocations + drz_stats.pointee_allocations > expected))
+  {
+    std::cerr << container_ << '<' << element_ << "> of " << size_ << " elements: "
+              << drz_stats.container_allocations + drz_stats.pointee_allocations << " allocations (expected at most " << expected << "), "
+              << srz_stats.buffer_regrowths + drz_stats.buffer_regrowths << " buffer regrowths once warm\n";
+    regressions = true;
+  }
+#endif
+
+  report(container_, element_, size_, "serialize",   binary.size(), srz_ns, memcpy_ns, srz_stats);
+  report(container_, element_, size_, "deserialize", binary.size(), drz_ns, memcpy_ns, drz_stats);
+}
+
+template<typename T>
+void benchmark_all(const char* const element_, const size_t size_)
+{
+  benchmark<std::vector<T>>                  ("vector",             element_, size_);
+  benchmark<std::deque<T>>                   ("deque",              element_, size_);
+  benchmark<std::list<T>>                    ("list",               element_, size_);
+  benchmark<std::set<T>>                     ("set",                element_, size_);
+  benchmark<std::multiset<T>>                ("multiset",           element_, size_);
+  benchmark<std::unordered_set<T>>           ("unordered_set",      element_, size_);
+  benchmark<std::unordered_multiset<T>>      ("unordered_multiset", element_, size_);
+  benchmark<std::map<T, T>>                  ("map",                element_, size_);
+  benchmark<std::multimap<T, T>>             ("multimap",           element_, size_);
+  benchmark<std::unordered_map<T, T>>        ("unordered_map",      element_, size_);
+  benchmark<std::unordered_multimap<T, T>>   ("unordered_multimap", element_, size_);
+}
+
+int main(int argc, char* argv[])
+{
+  size_t max_size = size_t(1) << 20;
+  bool   check    = false;
+
+  for (int k = 1; k < argc; ++k)
+  {
+    if (std::strcmp(argv[k], "--check") == 0)
+    {
+      check = true;
+    }
+    else
+    {
+      max_size = static_cast<size_t>(std::atoll(argv[k]));
+    }
+  }
+
+  std::cout << std::fixed;
+  std::cout.precision(3);
+
+  std::cout << "# seiriakos " << SEIRIAKOS_VERSION << '\n';
+  std::cout << "container,element,elements,direction,bytes,ns,ns_per_element,mb_per_s,memcpy_mb_per_s,vs_memcpy";
+#if defined(STZ_STATS)
+  std::cout << ",allocations,regrowths";
+#endif
+  std::cout << '\n';
+
+  for (const size_t size : {size_t(0), size_t(16), size_t(1024), size_t(1) << 20})
+  {
+    if (size > max_size) break;
+
+    benchmark_all<uint32_t>("uint32_t", size);
+    benchmark_all<Point>("Point", size);
+    benchmark<std::forward_list<uint32_t>>("forward_list", "uint32_t", size);
+    benchmark<std::string>("string", "char", size);
+
+    benchmark<std::vector<bool>>                   ("vector",         "bool",                  size);
+    benchmark<std::valarray<uint32_t>>             ("valarray",       "uint32_t",              size);
+    benchmark<std::stack<uint32_t>>                ("stack",          "uint32_t",              size);
+    benchmark<std::queue<uint32_t>>                ("queue",          "uint32_t",              size);
+    benchmark<std::priority_queue<uint32_t>>       ("priority_queue", "uint32_t",              size);
+    benchmark<std::vector<std::pair<uint32_t, float>>>            ("vector", "pair<uint32_t float>",         size);
+    benchmark<std::vector<std::tuple<uint32_t, float, uint16_t>>> ("vector", "tuple<uint32_t float uint16_t>", size);
+    benchmark<std::vector<std::unique_ptr<uint32_t>>>             ("vector", "unique_ptr<uint32_t>",         size);
+    benchmark<std::vector<std::shared_ptr<uint32_t>>>             ("vector", "shared_ptr<uint32_t>",         size);
+#if __cplusplus >= 201703L
+    benchmark<std::vector<std::optional<uint32_t>>>               ("vector", "optional<uint32_t>",           size);
+    benchmark<std::vector<std::variant<uint32_t, float>>>         ("vector", "variant<uint32_t float>",      size);
+#endif
+
+    // std::array lives on the stack, it stops at 1024 elements
+    switch (size)
+    {
+      case 0:
+        benchmark<std::array<uint32_t, 0>>("array", "uint32_t", size);
+        benchmark<std::bitset<0>>("bitset", "bool", size);
+        break;
+      case 16:
+        benchmark<std::array<uint32_t, 16>>("array", "uint32_t", size);
+        benchmark<std::bitset<16>>("bitset", "bool", size);
+        break;
+      case 1024:
+        benchmark<std::array<uint32_t, 1024>>("array", "uint32_t", size);
+        benchmark<std::bitset<1024>>("bitset", "bool", size);
+        break;
+      default:
+        benchmark<std::bitset<size_t(1) << 20>>("bitset", "bool", size);
+        break;
+    }
+  }
+
+#if defined(STZ_STATS)
+  return (check and regressions) ? 1 : 0;
+#else
+  (void)check;
+#endif
+}
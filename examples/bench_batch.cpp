@@ -0,0 +1,77 @@
+// runtime: run the executable, optionally with the largest thread count to try (default: hardware concurrency)
+#include <string>
+#include <vector>
+#include <thread>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include "../include/Seiriakos.hpp"
+#include "../include/Chronometro.hpp"
+
+struct Response
+{
+  uint64_t              id;
+  std::string           status;
+  std::vector<uint32_t> items;
+  double                latency;
+
+  stz::serialization_sequential(id, status, items, latency)
+};
+
+int main(int argc, char* argv[])
+{
+  constexpr unsigned ticks     = 1000;
+  constexpr size_t   responses = 4096;
+
+  const unsigned max_threads = (argc > 1) ? static_cast<unsigned>(std::atoi(argv[1]))
+    : std::max(1U, std::thread::hardware_concurrency());
+
+  std::vector<Response> tick;
+  for (size_t k = 0; k < responses; ++k)
+  {
+    tick.push_back(Response{k, (k % 10) ? "OK" : "NOT FOUND", std::vector<uint32_t>(k % 16, 7), 0.25 * static_cast<double>(k)});
+  }
+
+  std::cout << responses << " responses per tick:\n";
+
+  {
+    std::vector<stz::Bytes> binaries(responses);
+
+    stz::measure_block(ticks, "", "  serialize, one Bytes each:     %ms [avg = %Dus]")
+    {
+      for (size_t k = 0; k < responses; ++k)
+      {
+        binaries[k] = stz::serialize(tick[k]);
+      }
+    };
+  }
+
+  stz::Batch batch;
+
+  for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+  {
+    stz::Pool pool(threads);
+
+    std::cout << "  serialize_batch, " << threads << (threads == 1 ? " thread:  " : " threads: ");
+
+    stz::measure_block(ticks, "", "%ms [avg = %Dus]")
+    {
+      stz::serialize_batch(pool, tick.begin(), tick.end(), batch);
+    };
+
+    Response last = {};
+    stz::deserialize(batch.arena.data() + batch.spans.back().first, batch.spans.back().second, last);
+
+    if ((last.id != tick.back().id) or (last.items != tick.back().items))
+    {
+      std::cout << "  round-trip mismatch\n";
+    }
+
+    if ((threads < max_threads) and ((threads * 2) > max_threads))
+    {
+      threads = max_threads / 2;
+    }
+  }
+
+  std::cout << "  arena byte count: " << batch.used << '\n';
+}
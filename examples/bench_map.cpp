@@ -0,0 +1,61 @@
+// runtime: run the executable, the 10M-entry containers need about 2 GB of memory
+#include <map>
+#include <set>
+#include <cstdint>
+#include <iostream>
+#include "../include/Seiriakos.hpp"
+#include "../include/Chronometro.hpp"
+
+template<typename T>
+void benchmark(const char* const name_, const T& container_)
+{
+  constexpr unsigned iterations = 3;
+
+  stz::Bytes binary;
+  T          copy;
+
+  std::cout << name_ << ":\n";
+
+  for (auto iteration : stz::Measure(iterations, "", "  serialize:   %ms [avg = %Dms]"))
+  {
+    (void)iteration;
+    binary = stz::serialize(container_);
+  }
+
+  for (auto iteration : stz::Measure(iterations, "", "  deserialize: %ms [avg = %Dms]"))
+  {
+    {
+      const auto avoid = iteration.avoid(); // freeing the previous copy is not measured
+      copy = T();
+    }
+
+    stz::deserialize(binary.data(), binary.size(), copy);
+  }
+
+  std::cout << "  byte count:  " << binary.size() << (copy == container_ ? "\n" : " (round-trip mismatch)\n");
+}
+
+int main()
+{
+  constexpr uint64_t entries = 10000000;
+
+  {
+    std::map<uint64_t, uint64_t> index;
+    for (uint64_t k = 0; k < entries; ++k)
+    {
+      index.emplace_hint(index.end(), k * 7, k);
+    }
+
+    benchmark("std::map<uint64_t, uint64_t>, 10M entries", index);
+  }
+
+  {
+    std::multiset<uint32_t> keys;
+    for (uint64_t k = 0; k < entries; ++k)
+    {
+      keys.emplace_hint(keys.end(), static_cast<uint32_t>(k / 4));
+    }
+
+    benchmark("std::multiset<uint32_t>, 10M entries", keys);
+  }
+}
@@ -0,0 +1,77 @@
+// runtime: run the executable, it writes a ~200 MB snapshot to a temporary file
+// a checksum stands in for compression, the pipelined total should approach the slowest stage
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <iostream>
+#include "../include/Seiriakos.hpp"
+#include "../include/Chronometro.hpp"
+
+struct Record
+{
+  uint64_t              key;
+  std::string           label;
+  std::vector<uint32_t> values;
+
+  stz::serialization_sequential(key, label, values)
+};
+
+// FNV-1a, byte per byte so that it costs about as much as a fast compressor
+uint64_t checksum(const stz::Bytes& bytes_, uint64_t hash_ = 14695981039346656037ULL)
+{
+  for (const auto byte : bytes_)
+  {
+    hash_ = (hash_ ^ byte) * 1099511628211ULL;
+  }
+
+  return hash_;
+}
+
+int main()
+{
+  constexpr unsigned iterations = 3;
+  constexpr size_t   records    = 1000000;
+
+  std::vector<Record> snapshot;
+  for (size_t k = 0; k < records; ++k)
+  {
+    snapshot.push_back(Record{k, "record #" + std::to_string(k), std::vector<uint32_t>(40, static_cast<uint32_t>(k))});
+  }
+
+  std::FILE* const file = std::tmpfile();
+  if (file == nullptr)
+  {
+    std::cout << "could not open a temporary file\n";
+    return 1;
+  }
+
+  uint64_t sequential_hash = 0;
+  uint64_t pipelined_hash  = 0;
+
+  stz::measure_block(iterations, "", "sequential: %ms [avg = %Dms]")
+  {
+    std::rewind(file);
+
+    const stz::Bytes binary = stz::serialize(snapshot);
+    sequential_hash = checksum(binary);
+    std::fwrite(binary.data(), 1, binary.size(), file);
+    std::fflush(file);
+  };
+
+  stz::measure_block(iterations, "", "pipelined:  %ms [avg = %Dms]")
+  {
+    std::rewind(file);
+
+    pipelined_hash = 14695981039346656037ULL;
+    stz::serialize_pipelined(snapshot,
+      [&](stz::Bytes& chunk_){ pipelined_hash = checksum(chunk_, pipelined_hash); },
+      [&](const stz::Bytes& chunk_){ std::fwrite(chunk_.data(), 1, chunk_.size(), file); }
+    );
+    std::fflush(file);
+  };
+
+  std::fclose(file);
+
+  std::cout << (sequential_hash == pipelined_hash ? "checksums match\n" : "checksum mismatch\n");
+}
@@ -0,0 +1,116 @@
+// runtime: run the executable, optionally with the largest thread count to try (default: 64)
+// every thread serializes and deserializes an object of its own, the bytes are checked against a single-threaded run
+#include <map>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include "../include/Seiriakos.hpp"
+
+struct Position
+{
+  std::string           symbol;
+  int64_t               quantity;
+  double                average;
+  std::vector<uint32_t> fills;
+
+  stz::serialization_sequential(symbol, quantity, average, fills)
+};
+
+struct Account
+{
+  uint64_t                        id;
+  std::string                     owner;
+  std::map<std::string, Position> positions;
+
+  stz::serialization_sequential(id, owner, positions)
+};
+
+static Account make_account(const unsigned seed_)
+{
+  Account account;
+  account.id    = seed_;
+  account.owner = "owner #" + std::to_string(seed_);
+
+  for (unsigned k = 0; k < 64; ++k)
+  {
+    const std::string symbol = "SYM" + std::to_string(seed_ * 131 + k);
+    account.positions[symbol] = Position{symbol, int64_t(k) - 32, 1.5 * k, std::vector<uint32_t>(k % 8, seed_)};
+  }
+
+  return account;
+}
+
+int main(int argc, char* argv[])
+{
+  constexpr unsigned iterations = 2000;
+
+  const unsigned max_threads = (argc > 1) ? static_cast<unsigned>(std::atoi(argv[1])) : 64;
+
+  // expected bytes of every thread's object, computed before any thread is started
+  std::vector<Account>    accounts;
+  std::vector<stz::Bytes> expected;
+  for (unsigned k = 0; k < max_threads; ++k)
+  {
+    accounts.push_back(make_account(k));
+    expected.push_back(stz::serialize(accounts.back()));
+  }
+
+  std::cout << iterations << " round-trips of a " << expected.front().size() << " bytes object per thread:\n";
+
+  double single = 0;
+
+  for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+  {
+    std::atomic<unsigned> mismatches{0};
+    std::vector<std::thread> workers;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (unsigned t = 0; t < threads; ++t)
+    {
+      workers.emplace_back([&, t]
+      {
+        Account copy;
+
+        for (unsigned k = 0; k < iterations; ++k)
+        {
+          const stz::Bytes binary = stz::serialize(accounts[t]);
+          stz::deserialize(binary.data(), binary.size(), copy);
+
+          if ((binary != expected[t]) or (copy.owner != accounts[t].owner) or (copy.positions.size() != accounts[t].positions.size()))
+          {
+            ++mismatches;
+          }
+        }
+      });
+    }
+
+    for (auto& worker : workers)
+    {
+      worker.join();
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    const double throughput = threads * iterations / elapsed.count();
+
+    if (threads == 1)
+    {
+      single = throughput;
+    }
+
+    std::cout << "  " << threads << (threads == 1 ? " thread:  " : " threads: ")
+              << static_cast<uint64_t>(elapsed.count() * 1000) << "ms, "
+              << static_cast<uint64_t>(throughput) << " round-trips/s [x" << throughput / single << "]"
+              << (mismatches ? " (" + std::to_string(mismatches) + " mismatches)\n" : "\n");
+
+    if ((threads < max_threads) and ((threads * 2) > max_threads))
+    {
+      threads = max_threads / 2;
+    }
+  }
+}
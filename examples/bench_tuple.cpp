@@ -0,0 +1,58 @@
+// runtime: run the executable
+// compile-time: time the build of this target alone, e.g. 'time cmake --build . --target bench_tuple'
+#include <string>
+#include <tuple>
+#include <cstdint>
+#include <iostream>
+#include "../include/Seiriakos.hpp"
+#include "../include/Chronometro.hpp"
+
+using Fundamentals = std::tuple<
+  int8_t,  int16_t,  int32_t,  int64_t,  uint8_t, uint16_t, uint32_t, uint64_t,
+  float,   double,   char,     bool,     int8_t,  int16_t,  int32_t,  int64_t,
+  uint8_t, uint16_t, uint32_t, uint64_t, float,   double,   char,     bool,
+  int8_t,  int16_t,  int32_t,  int64_t,  uint8_t, uint16_t, uint32_t, uint64_t
+>;
+
+using Mixed = std::tuple<
+  int8_t,  int16_t,  int32_t,  int64_t,  uint8_t, uint16_t, uint32_t, uint64_t,
+  float,   double,   char,     bool,     int8_t,  int16_t,  int32_t,  std::string,
+  uint8_t, uint16_t, uint32_t, uint64_t, float,   double,   char,     bool,
+  int8_t,  int16_t,  int32_t,  int64_t,  uint8_t, uint16_t, uint32_t, std::string
+>;
+
+template<typename T>
+void benchmark(const char* const name_, const T& tuple_)
+{
+  constexpr unsigned iterations = 1000000;
+  constexpr unsigned warmup     = 10000;
+
+  stz::Bytes binary;
+  T          copy;
+
+  std::cout << name_ << ":\n";
+
+  stz::measure_block(stz::Warmup{warmup}, iterations, "", "  serialize:   %ms [avg = %Dns, median = %Mns, p99 = %P99ns, %O outliers]")
+  {
+    binary = stz::serialize(tuple_);
+  };
+
+  stz::measure_block(stz::Warmup{warmup}, iterations, "", "  deserialize: %ms [avg = %Dns, median = %Mns, p99 = %P99ns, %O outliers]")
+  {
+    stz::deserialize(binary.data(), binary.size(), copy);
+  };
+
+  std::cout << "  byte count:  " << binary.size() << (copy == tuple_ ? "\n" : " (round-trip mismatch)\n");
+}
+
+int main()
+{
+  Fundamentals fundamentals;
+  Mixed        mixed;
+
+  std::get<15>(mixed) = "sixteenth element";
+  std::get<31>(mixed) = "thirty-second element";
+
+  benchmark("32 fundamentals", fundamentals);
+  benchmark("30 fundamentals and 2 strings", mixed);
+}
@@ -4,6 +4,7 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <list>
 #include <memory>
 #include "../include/Seiriakos.hpp"
 
@@ -92,11 +93,13 @@ private:
 
   stz::serialization_procedural
   (
-    // serialize <= dynamic_cast<bus_stop>(*this);
-    serializer <= _name;
+    serializer <= stz::base_type<bus_stop>(this), _name;
   )
 };
 
+// bus_stop pointers are written with the id of their dynamic type
+STZ_MAKE_POLYMORPHIC(bus_stop, bus_stop_corner, bus_stop_destination)
+
 struct bus_route
 {
   bus_route() = default;
@@ -113,8 +116,6 @@ private:
 
   stz::serialization_procedural
   (
-    // ar.register_type(static_cast<bus_stop_corner*>(nullptr));
-    // ar.register_type(static_cast<bus_stop_destination*>(nullptr));
     serializer <= _stops;
   )
 };
@@ -214,14 +215,14 @@ int main()
   schedule_to_serialize.append("ted",    9, 38, &route1);
   schedule_to_serialize.append("alice", 11, 47, &route1);
 
-  // std::cout << "original schedule" << schedule_to_serialize;
-  stz::seiriakos::_seiriakos_impl::_srz_impl(route0);
+  std::cout << "original schedule" << schedule_to_serialize;
 
+  // shared routes and stops are written once, the restored schedule owns them
   auto binary       = stz::serialize(schedule_to_serialize);
   auto new_schedule = stz::deserialize<bus_schedule>(binary.data(), binary.size());
 
   // and display
-  // std::cout << "\nrestored schedule" << new_schedule;
+  std::cout << "\n\nrestored schedule" << new_schedule << "\n\n" << binary.size() << " bytes\n";
 }
 
 std::ostream& operator<<(std::ostream& ostream_, const gps_position& gps_position_)
@@ -244,7 +245,7 @@ std::ostream& operator<<(std::ostream& ostream_, const bus_route& bus_route_)
 {  
   for(const auto& stop_ptr : bus_route_._stops)
   {
-    ostream_ << '\n' << std::hex << "0x" << stop_ptr << std::dec << ' ' << *stop_ptr;
+    ostream_ << '\n' << std::hex << stop_ptr << std::dec << ' ' << *stop_ptr;
   }
 
   return ostream_;
@@ -24,12 +24,14 @@ private:
 struct Color
 {
   enum Basic : uint8_t { Black, Red, Green, Yellow, Blue,  Magenta, Cyan,  White, Gray };
+  stz::serialization_enum_range(Basic, Black, Gray);
 
   Color(const Basic basic_);
   Color(uint8_t R, uint8_t G, uint8_t B);
 
 private:
   enum class Type : uint8_t { RGB, BASIC } _type;
+  stz::serialization_enum_range(Type, Type::RGB, Type::BASIC);
   union Data
   {
     uint8_t _rgb[3] = {};
@@ -59,6 +61,7 @@ private:
 struct Chair
 {
   enum Type : uint8_t { Recliner, Loveseat, Banquette, Stool };
+  stz::serialization_enum_range(Type, Recliner, Stool);
   Chair() = default;
   Chair(Type type_, Color color_) : type(type_), color(color_) {}
 
@@ -94,7 +97,7 @@ struct Bar : private Building
   Person             owner;
   std::vector<Chair> seats;
 
-  stz::serialization_sequential(stz::base_type<Building>(this), seats, owner)
+  stz::serialization_sequential(stz::base_type<Building>(this), stz::run_length(seats), owner)
 };
 
 int main()
@@ -42,6 +42,10 @@ blocks and more. See the included README.MD file for more information.
 #include <utility>   // for std::move
 #include <cstdio>    // for std::sprintf
 #include <exception> // for std::exception
+#include <vector>    // for std::vector
+#include <algorithm> // for std::sort, std::nth_element
+#include <cmath>     // for std::sqrt
+#include <cctype>    // for std::isdigit
 //---conditionally necessary standard libraries-------------------------------------------------------------------------
 #if not defined(CHRONOMETRO_CLOCK)
 # include <type_traits> // for std::conditional
@@ -65,6 +69,13 @@ inline namespace chronometro
   // measure iterations via range-based for-loop
   class Measure;
 
+  // iterations run before those measured by Measure and measure_block, they appear in no time nor statistic
+  struct Warmup;
+
+  // total formats may also use, followed by a unit like %D: %L for the fastest iteration, %M for the median, %P90
+  // and %P99 for percentiles (any two digits), %S for the standard deviation and %A for the median absolute deviation;
+  // %O gives how many iterations are outliers, more than 3.5 scaled median absolute deviations away from the median
+
   // units in which time obtained from Stopwatch can
   // be displayed and in which sleep() be slept with.
   enum class Unit
@@ -370,6 +381,117 @@ inline namespace chronometro
       return std::chrono::nanoseconds(std::chrono::milliseconds(milliseconds_)).count();
     }
 
+    // per-iteration samples are only kept, in storage reserved up front, when the total format asks for statistics
+    inline auto _samples_for(const char* const fmt_, const unsigned n_iters_) -> std::vector<std::chrono::nanoseconds::rep>
+    {
+      std::vector<std::chrono::nanoseconds::rep> samples;
+
+      if (fmt_ == nullptr) return samples;
+
+      for (const char* const specifier : {"%L", "%M", "%P", "%S", "%A", "%O"})
+      {
+        if (std::string(fmt_).find(specifier) != std::string::npos)
+        {
+          samples.reserve(n_iters_);
+          break;
+        }
+      }
+
+      return samples;
+    }
+
+    // formats the time specifiers preceded by 'prefix_' with 'time_'
+    inline auto _prefixed_fmt(const _time<Unit::automatic, 3> time_, std::string&& fmt_, const std::string& prefix_) noexcept
+      -> std::string
+    {
+      bool found = false;
+
+      for (auto position = fmt_.find('%' + prefix_); position != std::string::npos; position = fmt_.find('%' + prefix_, position))
+      {
+        fmt_.erase(position + 1, prefix_.length());
+        found = true;
+      }
+
+      return found ? _format_time(time_, std::move(fmt_)) : std::move(fmt_);
+    }
+
+    inline auto _stats_fmt(std::string&& fmt_, std::vector<std::chrono::nanoseconds::rep>& samples_) noexcept -> std::string
+    {
+      using rep = std::chrono::nanoseconds::rep;
+
+      if (samples_.empty()) return std::move(fmt_);
+
+      std::sort(samples_.begin(), samples_.end());
+
+      const size_t n      = samples_.size();
+      const rep    median = (n % 2) ? samples_[n/2] : (samples_[n/2 - 1] + samples_[n/2])/2;
+
+      double mean = 0;
+      for (const rep sample : samples_)
+      {
+        mean += static_cast<double>(sample);
+      }
+      mean /= static_cast<double>(n);
+
+      double variance = 0;
+      for (const rep sample : samples_)
+      {
+        variance += (static_cast<double>(sample) - mean)*(static_cast<double>(sample) - mean);
+      }
+      variance /= static_cast<double>((n > 1) ? (n - 1) : 1);
+
+      // nearest-rank percentiles, read before the samples are turned into deviations
+      for (auto position = fmt_.find("%P"); position != std::string::npos; position = fmt_.find("%P", position))
+      {
+        size_t digits  = 0;
+        size_t percent = 0;
+        for (; (position + 2 + digits < fmt_.size()) and std::isdigit(fmt_[position + 2 + digits]); ++digits)
+        {
+          percent = std::min<size_t>(100, 10*percent + static_cast<size_t>(fmt_[position + 2 + digits] - '0'));
+        }
+
+        if _stz_impl_ABNORMAL(digits == 0)
+        {
+          position += 2;
+          continue;
+        }
+
+        const size_t rank = (percent*n + 99)/100;
+
+        fmt_.erase(position + 1, 1 + digits);
+        fmt_ = _format_time(_time<Unit::automatic, 3>{std::chrono::nanoseconds(samples_[(rank > 0) ? (rank - 1) : 0])}, std::move(fmt_));
+      }
+
+      const rep fastest = samples_.front();
+
+      for (rep& sample : samples_)
+      {
+        sample = (sample < median) ? (median - sample) : (sample - median);
+      }
+
+      std::nth_element(samples_.begin(), samples_.begin() + static_cast<std::ptrdiff_t>(n/2), samples_.end());
+      const rep mad = samples_[n/2];
+
+      // modified z-score above 3.5, none when at least half the iterations took the median time
+      size_t outliers = 0;
+      for (const rep deviation : samples_)
+      {
+        outliers += (mad != 0) and (0.6745*static_cast<double>(deviation) > 3.5*static_cast<double>(mad));
+      }
+
+      fmt_ = _prefixed_fmt(_time<Unit::automatic, 3>{std::chrono::nanoseconds(fastest)}, std::move(fmt_), "L");
+      fmt_ = _prefixed_fmt(_time<Unit::automatic, 3>{std::chrono::nanoseconds(median)},  std::move(fmt_), "M");
+      fmt_ = _prefixed_fmt(_time<Unit::automatic, 3>{std::chrono::nanoseconds(static_cast<rep>(std::sqrt(variance)))}, std::move(fmt_), "S");
+      fmt_ = _prefixed_fmt(_time<Unit::automatic, 3>{std::chrono::nanoseconds(mad)}, std::move(fmt_), "A");
+
+      for (auto position = fmt_.find("%O"); position != std::string::npos; position = fmt_.find("%O", position))
+      {
+        fmt_.replace(position, 2, std::to_string(outliers));
+      }
+
+      return std::move(fmt_);
+    }
+
     struct _measure_block;
 
     template<std::chrono::nanoseconds::rep DURATION>
@@ -452,12 +574,19 @@ inline namespace chronometro
     // measure iterations with custom total message
     inline Measure(const char* total_format, unsigned iterations) noexcept;
 
+    // run unmeasured iterations first, the other arguments are those of the constructors above
+    template<typename... T>
+    Measure(Warmup warmup, T... arguments) noexcept;
+
   private:
     const unsigned    _iterations = 1;
     unsigned          _remaining  = _iterations;
+    unsigned          _warmup     = 0;
+    unsigned          _warming    = 0;
     const char* const _split_fmt  = nullptr;
     const char* const _total_fmt  = "total elapsed time: %ms";
     Stopwatch         _stopwatch;
+    std::vector<std::chrono::nanoseconds::rep> _samples = _chronometro_impl::_samples_for(_total_fmt, _iterations);
     class _iterator;
   public:
     inline auto begin()     noexcept -> _iterator;
@@ -470,6 +599,11 @@ inline namespace chronometro
     inline void _stop() noexcept;
     friend _chronometro_impl::_measure_block;
   };
+//*///------------------------------------------------------------------------------------------------------------------
+  struct Warmup final
+  {
+    unsigned iterations;
+  };
 //*///------------------------------------------------------------------------------------------------------------------
   class Measure::Iteration final
   {
@@ -782,6 +916,14 @@ inline namespace chronometro
     , _total_fmt(total_format_ && *total_format_ ? total_format_ : nullptr)
   {}
 
+  template<typename... T>
+  Measure::Measure(const Warmup warmup_, T... arguments_) noexcept
+    : Measure(arguments_...)
+  {
+    _warmup  = warmup_.iterations;
+    _warming = warmup_.iterations;
+  }
+
   void Measure::pause() noexcept
   {
     _stopwatch.pause();
@@ -800,6 +942,8 @@ inline namespace chronometro
   auto Measure::begin() noexcept -> _iterator
   {
     _remaining = _iterations;
+    _warming   = _warmup;
+    _samples.clear();
 
     _stopwatch.start();
     _stopwatch.reset();
@@ -826,7 +970,7 @@ inline namespace chronometro
   {
     const auto avoid = _stopwatch.avoid();
 
-    if _stz_impl_EXPECTED(_remaining)
+    if _stz_impl_EXPECTED(_remaining or _warming)
     {
       return true;
     }
@@ -836,7 +980,8 @@ inline namespace chronometro
     if _stz_impl_EXPECTED(_total_fmt)
     {
       _stz_impl_DECLARE_LOCK(_chronometro_impl::_out_mtx);
-      io::out << _chronometro_impl::_total_fmt(duration, _total_fmt, _iterations) << std::endl;
+      io::out << _chronometro_impl::_stats_fmt(_chronometro_impl::_total_fmt(duration, _total_fmt, _iterations), _samples)
+              << std::endl;
     }
 
     return false;
@@ -847,6 +992,19 @@ inline namespace chronometro
     const auto avoid = _stopwatch.avoid();
     const auto split = _stopwatch.split();
 
+    // the measurement starts over once warmed up
+    if _stz_impl_ABNORMAL(_warming)
+    {
+      --_warming;
+      _stopwatch.reset();
+      return;
+    }
+
+    if (_samples.size() < _samples.capacity())
+    {
+      _samples.push_back(split.nanoseconds.count());
+    }
+
     if (_split_fmt)
     {
       _stz_impl_DECLARE_LOCK(_chronometro_impl::_out_mtx);
@@ -861,11 +1019,13 @@ inline namespace chronometro
     const auto duration = _stopwatch.total();
     
     _remaining = 0;
+    _warming   = 0;
 
     if _stz_impl_EXPECTED(_total_fmt)
     {
       _stz_impl_DECLARE_LOCK(_chronometro_impl::_out_mtx);
-      io::out << _chronometro_impl::_total_fmt(duration, _total_fmt, _iterations) << std::endl;
+      io::out << _chronometro_impl::_stats_fmt(_chronometro_impl::_total_fmt(duration, _total_fmt, _iterations), _samples)
+              << std::endl;
     }
   }
 
@@ -44,6 +44,65 @@ and deserialize base_ptrs.
 
 std::bitset is assumed to be contiguous.
 
+serialization_sequential(...) must appear after the members it lists, their compile-time size is
+deduced where it expands.
+
+Pointees are written once per call to serialize(...), later pointers to them are written as
+references. Raw pointers deserialize to objects allocated with new which the caller owns, unless
+a std::unique_ptr or std::shared_ptr of the same stream refers to them as well.
+
+STZ_MAKE_POLYMORPHIC(BASE, ...) must appear at global scope, after the listed types are defined and
+before pointers to 'BASE' are serialized. It relies on typeid, and the listed types must derive
+non-virtually from 'BASE'.
+
+Enumerations with a declared range are written as their offset from MIN on as few bytes as the
+range allows, std::vector of them on as few bits. Values outside of the range are not supported.
+Nested enumerations must use serialization_enum_range(...) in their class, a specialization of
+stz::enum_range after the class would come after its first use.
+
+In C++17, aggregates without serialization_sequential(...) are serialized automatically: trivially
+copyable ones without padding, whose fields are all arithmetic, enumerations without enum_range or
+arrays and aggregates of those, as their bytes, the others field by field. Trivially copyable
+aggregates whose fields cannot be told apart, because of base classes or more than 32 fields, are
+copied whole as well, padding and pointers included. The others must have at most 32 fields and no
+base classes nor bit-fields, or use serialization_sequential(...).
+
+Defining STZ_PRESERVE_BUCKETS makes unordered containers also write their bucket count and maximum
+load factor, and restore them on load. The serializing and deserializing sides must agree on it.
+Unless STZ_UNSAFE is defined, a bucket count above the element count plus the bytes left to read is
+restored as that sum, so corrupted input cannot request an arbitrarily large allocation.
+
+parallel_serialize(...) serializes the chunks of a container independently of one another. If any
+element reaches a pointee, the chunks are thrown away and the container is serialized again on the
+calling thread, since where a pointee is written depends on every element before it. The bytes are
+those of serialize(...) either way.
+
+chunked(...) cuts a std::vector into at most 64 chunks preceded by their byte lengths, pointees
+are not shared between chunks. parallel_deserialize(...) decodes the chunks across its pool, the
+elements are default-constructed first and then deserialized into.
+
+serialize_async(...) pauses, in C++20, between the elements of the containers parallel_serialize(...)
+splits, and within the pairs, tuples, aggregates, bases and serialization_sequential(...) classes
+holding such containers. A serialization_procedural(...) block is run again at each resume, skipping
+what it already wrote, so it pauses within its object's own members but writes anything else whole.
+Everything else is serialized whole before being cut into windows.
+
+With STZ_DEBUGGING, every thread records what it serializes and deserializes in a ring of
+STZ_TRACE_CAPACITY records (4096 by default) without locking: the type, depth, offset and byte count.
+flush_trace() formats them to io::dbg; records that do not fit before the next call are dropped.
+The ring of a thread that exits is reused by the next thread to record, after its own records.
+
+With STZ_STATS, stats() counts per thread the calls to serialize(...) and deserialize(...), the
+bytes they wrote and read, the reallocations of the internal buffer, the Bytes serialize(...) returns
+and the allocations made while deserializing: vector and string growth, list and tree nodes,
+unordered nodes and buckets, and pointees. std::deque is not counted, nor are the allocations made by the elements' own types.
+Pool threads count in stats() of their own. Without STZ_STATS, none of this is compiled.
+
+serialize(...) and deserialize(...) may be called from any number of threads at once, each thread
+works in buffers of its own. This holds whenever the standard library provides std::thread, which
+is detected through <thread> if the compiler does not define __STDCPP_THREADS__; STZ_THREADSAFE
+forces it and STZ_NOT_THREADSAFE opts out, leaving out Pool and everything built on it.
+
 std::priority_queue potentially triggers '-Wstrict-overflow' if compiling with GCC >= 9.1
 with -Wstrict-overflow=3 and above.
 
@@ -57,23 +116,50 @@ with -Wstrict-overflow=3 and above.
 #include <vector>      // for std::vector
 #include <type_traits> // for std::enable_if, std::is_*, std::remove_pointer
 #include <iostream>    // for std::clog
-#include <cstring>     // for std::memcpy
+#include <cstring>     // for std::memcpy, std::memcmp
+#include <algorithm>   // for std::rotate, std::make_heap
+#include <typeinfo>    // for typeid
+#include <cstdio>      // for std::snprintf
 //---conditionally necessary standard libraries-------------------------------------------------------------------------
-#if defined(__STDCPP_THREADS__) and not defined(STZ_NOT_THREADSAFE)
-# define  _stz_impl_THREADSAFE
-# include <atomic> // for std::atomic
-# include <mutex>  // for std::mutex, std::lock_guard
+#if not defined(STZ_NOT_THREADSAFE)
+# if defined(__STDCPP_THREADS__) or defined(_MSC_VER) or defined(STZ_THREADSAFE)
+#   define _stz_impl_THREADSAFE
+# elif defined(__has_include)
+#   if __has_include(<thread>)
+#     include <thread>
+#     if defined(_GLIBCXX_HAS_GTHREADS)
+#       define _stz_impl_THREADSAFE
+#     elif defined(_LIBCPP_HAS_THREADS)
+#       if _LIBCPP_HAS_THREADS
+#         define _stz_impl_THREADSAFE
+#       endif
+#     elif defined(_LIBCPP_VERSION) and not defined(_LIBCPP_HAS_NO_THREADS)
+#       define _stz_impl_THREADSAFE
+#     endif
+#   endif
+# endif
+#endif
+#if defined(_stz_impl_THREADSAFE)
+# include <atomic>             // for std::atomic
+# include <mutex>              // for std::mutex, std::lock_guard
+# include <thread>             // for std::thread
+# include <condition_variable> // for std::condition_variable
+# include <system_error>       // for std::system_error
 #endif
 #if defined(STZ_DEBUGGING)
 #if defined(__clang__) or defined(__GNUC__)
 # include <cxxabi.h> // for abi::__cxa_demangle
 #endif
-# include <typeinfo> // for typeid
 # include <cstdlib>  // for std::free
+# include <atomic>   // for std::atomic
 #endif
 #if not defined(STZ_UNSAFE)
 #include  <cassert>  // for assert
 #endif
+#if defined(__cpp_impl_coroutine)
+# include <coroutine> // for std::coroutine_handle, std::suspend_always
+# include <exception> // for std::terminate
+#endif
 //*///------------------------------------------------------------------------------------------------------------------
 #include <array>         // for std::array
 #include <complex>       // for std::complex
@@ -92,6 +178,14 @@ with -Wstrict-overflow=3 and above.
 #include <stack>         // for std::stack
 #include <forward_list>  // for std::forward_list
 #include <queue>         // for std::queue
+#include <memory>        // for std::unique_ptr, std::shared_ptr
+#include <iterator>      // for std::random_access_iterator_tag
+#if __cplusplus >= 201703L
+#include <optional>      // for std::optional
+#include <variant>       // for std::variant, std::monostate
+#include <string_view>   // for std::basic_string_view
+#include <memory_resource> // for std::pmr::memory_resource, std::pmr::polymorphic_allocator
+#endif
 //
 
 // things that make no sens i think
@@ -105,7 +199,6 @@ with -Wstrict-overflow=3 and above.
 // #include <istream>
 // #include <new>
 // #include <stdexcept>
-// #include <memory> // std::unique_ptr, std::shared_ptr, std::weak_ptr
 // #include <new>
 // #include <thread // thread/jthread
 // #include <future>
@@ -127,6 +220,15 @@ inline namespace seiriakos
   // macro to add .serialize() and .deserialize(...) methods to a class
 # define serialization_methods()
 
+  // macro to register the derived types a pointer to 'BASE' may point to, at global scope
+# define STZ_MAKE_POLYMORPHIC(BASE, ...)
+
+  // macro to declare the [MIN, MAX] range of an enumeration declared in the same class
+# define serialization_enum_range(ENUM, MIN, MAX)
+
+  // macro to declare the [MIN, MAX] range of an enumeration, at global scope
+# define STZ_MAKE_ENUM_RANGE(ENUM, MIN, MAX)
+
   enum Byte : uint8_t;
 
   using Bytes = std::vector<Byte>;
@@ -141,6 +243,13 @@ inline namespace seiriakos
 
   template<typename type>
   type deserialize(const Byte data[], size_t size) noexcept;
+
+# if __cplusplus >= 201703L
+  // deserialize a 'type' constructed with 'resource', aggregates field by field, its containers pass it on to the
+  // elements they construct
+  template<typename type>
+  type deserialize(const Byte data[], size_t size, std::pmr::memory_resource* resource) noexcept;
+# endif
   
   template<class base, typename ptr>
   struct Inheritence;
@@ -151,15 +260,98 @@ inline namespace seiriakos
   template<typename type>
   auto as_mutable(const type& const_data) -> type&;
 
+  // tag given to the constructor of elements that are not default-constructible, before deserializing into them
+  struct Deserializing;
+
   template<unsigned size, typename type>
   struct Bitfield;
 
   template<unsigned size, typename type>
   auto bitfield(type bitfield_data) -> Bitfield<size, type>;
 
+  // serialized size of 'type' known at compile time, 0 if it depends on the value
+  template<typename type>
+  struct static_size;
+
+  // range of the enumeration 'type', its values are written on as few bytes as the range allows
+  template<typename type>
+  struct enum_range;
+
+  template<typename type>
+  struct RunLength;
+
+  // run-length encode consecutive identical elements of 'container'
+  template<typename type>
+  auto run_length(type& container) -> RunLength<type>;
+
+  template<typename type>
+  struct NodeReuse;
+
+  // deserialize into the associative 'container' by refilling the nodes it already has instead of freeing them
+  template<typename type>
+  auto node_reuse(type& container) -> NodeReuse<type>;
+
+  // deserialize into the container given to node_reuse(...)
+  template<typename type>
+  void deserialize(const Byte data[], size_t size, NodeReuse<type>&& node_reuse) noexcept;
+
+  template<typename type>
+  struct Chunked;
+
+  // encode the std::vector 'container' as chunks that can be decoded independently of one another
+  template<typename type>
+  auto chunked(type& container) -> Chunked<type>;
+
+  // deserialize into the container given to chunked(...)
+  template<typename type>
+  void deserialize(const Byte data[], size_t size, Chunked<type>&& chunked) noexcept;
+
+# if defined(_stz_impl_THREADSAFE)
+  // worker threads tasks are spread across, the thread handing them out takes part as well
+  class Pool;
+
+  // same bytes as serialize(thing), the elements of a large container are serialized in chunks across 'pool'
+  template<typename type>
+  auto parallel_serialize(Pool& pool, const type& thing) noexcept -> Bytes;
+
+  // deserialize into 'things', the chunks of the containers given to chunked(...) are decoded across 'pool'
+  template<typename... type>
+  void parallel_deserialize(Pool& pool, const Byte data[], size_t size, type&&... things) noexcept;
+
+  // bytes of many objects serialized separately, laid out one after the other in a single arena
+  struct Batch;
+
+  // serialize every object of [first, last) on its own across 'pool', 'batch' is reused from call to call; the objects
+  // go by tasks of 16 that threads take from a shared counter as they finish, rather than steal from one another
+  template<typename iterator>
+  void serialize_batch(Pool& pool, iterator first, iterator last, Batch& batch) noexcept;
+
+  // serialize 'thing' in chunks of at least 'chunk_size' bytes, each chunk goes through 'transform(Bytes&)' on a
+  // second thread and then 'sink(const Bytes&)' on a third one while the next chunks are being serialized; containers
+  // are cut between their elements, anything else is handed out as one chunk
+  template<typename type, typename transform_type, typename sink_type>
+  void serialize_pipelined(const type& thing, transform_type&& transform, sink_type&& sink, size_t chunk_size = 1 << 20) noexcept;
+# endif
+
+  // chunks of serialize(thing) handed out one after the other, all of 'window' bytes but the last one
+  class Chunks;
+
+  // from C++20 on each chunk is produced as the previous one is consumed, 'thing' must outlive the chunks
+  template<typename type>
+  auto serialize_async(const type& thing, size_t window = 1 << 16) noexcept -> Chunks;
+
   inline // convert bytes to const char*
   auto hex_string(const Byte data[], const size_t size) -> const char*;
 
+  inline // write to io::dbg what every thread traced since the last call, does nothing unless STZ_DEBUGGING is defined
+  void flush_trace() noexcept;
+
+  // counters of one thread, assign {} to reset them
+  struct Stats;
+
+  inline // what serialize(...) and deserialize(...) did on the calling thread, stays all zeros unless STZ_STATS is defined
+  auto stats() noexcept -> Stats&;
+
   namespace io
   {
     static std::ostream out(std::cout.rdbuf()); // output
@@ -177,16 +369,16 @@ inline namespace seiriakos
   template<class base, typename ptr>
   struct Inheritence
   {
-    static_assert(std::is_base_of<base, typename std::remove_pointer<ptr>::type>::value,
-      "stz: Inheritence: 'ptr' must be a pointer to a type derived from 'base'."
-    );
-
     const ptr base_ptr;
   };
 
   template<class base, class type>
   auto base_type(type* const base_ptr_) -> Inheritence<base, type*>
   {
+    static_assert(std::is_base_of<base, type>::value,
+      "stz: Inheritence: 'ptr' must be a pointer to a type derived from 'base'."
+    );
+
     return Inheritence<base, type*>{base_ptr_};
   }
 
@@ -196,11 +388,352 @@ inline namespace seiriakos
     return const_cast<type&>(const_data_);
   }
 
+  struct Deserializing
+  {};
+
   template<unsigned size, typename type>
   struct Bitfield
   {
     type proxy = {};
   };
+
+  template<typename type>
+  struct RunLength
+  {
+    type* const container_ptr;
+  };
+
+  template<typename type>
+  auto run_length(type& container_) -> RunLength<type>
+  {
+    return RunLength<type>{&container_};
+  }
+
+  template<typename type>
+  struct NodeReuse
+  {
+    type* const container_ptr;
+  };
+
+  template<typename type>
+  auto node_reuse(type& container_) -> NodeReuse<type>
+  {
+    return NodeReuse<type>{&container_};
+  }
+
+  template<typename type>
+  struct Chunked
+  {
+    type* const container_ptr;
+  };
+
+  template<typename type>
+  auto chunked(type& container_) -> Chunked<type>
+  {
+    return Chunked<type>{&container_};
+  }
+
+# if defined(_stz_impl_THREADSAFE)
+  class Pool final
+  {
+  public:
+    // 'threads' counts the calling thread, 'threads - 1' workers are started, fewer if the system refuses some
+    explicit Pool(const unsigned threads_ = std::thread::hardware_concurrency()) noexcept
+    {
+      const unsigned workers = (threads_ > 1) ? (threads_ - 1) : 0;
+
+      _workers.reserve(workers);
+      for (unsigned k = 0; k < workers; ++k)
+      {
+#   if defined(__cpp_exceptions)
+        // the calling thread takes part in every run, the pool works with the workers already started
+        try
+        {
+          _workers.emplace_back([this]{ _work(); });
+        }
+        catch (const std::system_error&)
+        {
+          break;
+        }
+#   else
+        _workers.emplace_back([this]{ _work(); });
+#   endif
+      }
+    }
+
+    ~Pool() noexcept
+    {
+      {
+        std::lock_guard<std::mutex> lock{_mtx};
+        _stopping = true;
+      }
+
+      _wake.notify_all();
+
+      for (auto& worker : _workers)
+      {
+        worker.join();
+      }
+    }
+
+    Pool(const Pool&)            = delete;
+    Pool& operator=(const Pool&) = delete;
+
+    auto size() const noexcept -> unsigned
+    {
+      return static_cast<unsigned>(_workers.size()) + 1;
+    }
+
+    // call 'task(k)' for every k in [0, count) on the workers and the calling thread, return once all calls returned
+    template<typename F>
+    void run(const size_t count_, F&& task_) noexcept
+    {
+      std::lock_guard<std::mutex> running{_run_mtx};
+
+      {
+        std::unique_lock<std::mutex> lock{_mtx};
+
+        // a worker still leaving the previous run would otherwise take indices of this one
+        _idle.wait(lock, [this]{ return _active == 0; });
+
+        _task   = const_cast<void*>(static_cast<const void*>(&task_));
+        _invoke = [](void* const task_ptr_, const size_t k_){ (*static_cast<typename std::remove_reference<F>::type*>(task_ptr_))(k_); };
+        _count  = count_;
+        _next.store(0, std::memory_order_relaxed);
+        ++_generation;
+      }
+
+      _wake.notify_all();
+
+      _help();
+
+      std::unique_lock<std::mutex> lock{_mtx};
+      _idle.wait(lock, [this]{ return _active == 0; });
+    }
+
+  private:
+    std::vector<std::thread> _workers;
+    std::mutex               _run_mtx;
+    std::mutex               _mtx;
+    std::condition_variable  _wake;
+    std::condition_variable  _idle;
+    void*                    _task       = nullptr;
+    void                   (*_invoke)(void*, size_t) = nullptr;
+    size_t                   _count      = 0;
+    std::atomic<size_t>      _next       = {0};
+    unsigned                 _generation = 0;
+    unsigned                 _active     = 0;
+    bool                     _stopping   = false;
+
+    void _help() noexcept
+    {
+      for (size_t k; (k = _next.fetch_add(1, std::memory_order_relaxed)) < _count;)
+      {
+        _invoke(_task, k);
+      }
+    }
+
+    void _work() noexcept
+    {
+      std::unique_lock<std::mutex> lock{_mtx};
+
+      for (unsigned seen = _generation;;)
+      {
+        _wake.wait(lock, [&]{ return _stopping or (_generation != seen); });
+
+        if (_stopping) return;
+
+        seen = _generation;
+        ++_active;
+
+        lock.unlock();
+        _help();
+        lock.lock();
+
+        if (--_active == 0)
+        {
+          _idle.notify_all();
+        }
+      }
+    }
+  };
+
+  struct Batch
+  {
+    // object k is serialized at arena[spans[k].first, spans[k].first + spans[k].second), the objects fill the first
+    // 'used' bytes of the arena
+    Bytes                                  arena;
+    std::vector<std::pair<size_t, size_t>> spans;
+    size_t                                 used = 0;
+
+    // tasks claim their slab of the arena as they finish, in that order; the arena is never shrunk, so that
+    // steady-state batches fit in it without being written over first, the tasks that do not fit wait here until it is
+    // grown
+    std::vector<Bytes> slabs;
+  };
+# endif
+
+  class Chunks final
+  {
+  public:
+    class iterator final
+    {
+    public:
+      auto operator*() const noexcept -> const Bytes&
+      {
+        return _chunks->_current();
+      }
+
+      auto operator++() noexcept -> iterator&
+      {
+        if (not _chunks->_next())
+        {
+          _chunks = nullptr;
+        }
+
+        return *this;
+      }
+
+      bool operator!=(const iterator& other_) const noexcept
+      {
+        return _chunks != other_._chunks;
+      }
+
+    private:
+      explicit iterator(Chunks* const chunks_) noexcept :
+        _chunks(chunks_)
+      {}
+
+      Chunks* _chunks;
+      friend Chunks;
+    };
+
+    // produces the first chunk, a Chunks is meant to be iterated once
+    auto begin() noexcept -> iterator
+    {
+      return ++iterator(this);
+    }
+
+    auto end() noexcept -> iterator
+    {
+      return iterator(nullptr);
+    }
+
+#   if defined(__cpp_impl_coroutine)
+    struct promise_type
+    {
+      const Bytes* chunk = nullptr;
+
+      auto get_return_object() noexcept -> Chunks
+      {
+        return Chunks(std::coroutine_handle<promise_type>::from_promise(*this));
+      }
+
+      auto initial_suspend() noexcept -> std::suspend_always { return {}; }
+      auto final_suspend()   noexcept -> std::suspend_always { return {}; }
+
+      auto yield_value(const Bytes& chunk_) noexcept -> std::suspend_always
+      {
+        chunk = &chunk_;
+        return {};
+      }
+
+      void return_void() noexcept {}
+
+      void unhandled_exception() noexcept
+      {
+        std::terminate();
+      }
+    };
+
+    Chunks(Chunks&& other_) noexcept :
+      _handle(other_._handle)
+    {
+      other_._handle = nullptr;
+    }
+
+    ~Chunks() noexcept
+    {
+      if (_handle) _handle.destroy();
+    }
+
+  private:
+    std::coroutine_handle<promise_type> _handle;
+
+    explicit Chunks(const std::coroutine_handle<promise_type> handle_) noexcept :
+      _handle(handle_)
+    {}
+
+    bool _next() noexcept
+    {
+      _handle.resume();
+      return not _handle.done();
+    }
+
+    auto _current() const noexcept -> const Bytes&
+    {
+      return *_handle.promise().chunk;
+    }
+#   else
+    Chunks(Chunks&&) noexcept = default;
+
+  private:
+    // no coroutines, the bytes are serialized up front and copied out one window at a time
+    Chunks(Bytes&& bytes_, const size_t window_) noexcept :
+      _bytes(std::move(bytes_)),
+      _window(window_)
+    {}
+
+    template<typename type>
+    friend auto serialize_async(const type&, size_t) noexcept -> Chunks;
+
+    Bytes  _bytes;
+    Bytes  _chunk;
+    size_t _window;
+    size_t _front = 0;
+
+    bool _next() noexcept
+    {
+      if (_front == _bytes.size()) return false;
+
+      const size_t length = std::min(_window, _bytes.size() - _front);
+      _chunk.assign(_bytes.data() + _front, _bytes.data() + _front + length);
+      _front += length;
+
+      return true;
+    }
+
+    auto _current() const noexcept -> const Bytes&
+    {
+      return _chunk;
+    }
+#   endif
+
+    Chunks(const Chunks&)            = delete;
+    Chunks& operator=(const Chunks&) = delete;
+  };
+
+  struct Stats
+  {
+    size_t serialize_calls       = 0; // calls to serialize(...)
+    size_t deserialize_calls     = 0; // calls to deserialize(...), whichever overload
+    size_t bytes_written         = 0; // bytes returned by serialize(...)
+    size_t bytes_read            = 0; // bytes consumed by deserialize(...)
+    size_t buffer_regrowths      = 0; // reallocations of the internal buffer
+    size_t container_allocations = 0; // the returned Bytes, and vector and string growth, nodes, unordered buckets, while deserializing
+    size_t container_bytes       = 0; // bytes requested by those, without the allocator's own overhead
+    size_t pointee_allocations   = 0; // objects allocated for pointers while deserializing
+  };
+
+  namespace _seiriakos_impl
+  {
+    template<typename T, typename = void>
+    struct _enum_hook;
+  }
+
+  template<typename type>
+  struct enum_range : _seiriakos_impl::_enum_hook<type>
+  {};
 //*///------------------------------------------------------------------------------------------------------------------
   namespace _seiriakos_impl
   {
@@ -295,7 +828,6 @@ inline namespace seiriakos
 # endif
 
 # if defined(_stz_impl_THREADSAFE)
-#   undef  _stz_impl_THREADSAFE
 #   define _stz_impl_THREADLOCAL         thread_local
 #   define _stz_impl_ATOMIC(T)           std::atomic<T>
 #   define _stz_impl_DECLARE_MUTEX(...)  static std::mutex __VA_ARGS__
@@ -308,11 +840,87 @@ inline namespace seiriakos
 # endif
 
     static _stz_impl_THREADLOCAL Bytes  _buffer;
-    static _stz_impl_THREADLOCAL size_t _buffer_front;
+
+    // the bytes being deserialized, read in place from the caller's array until 'end'
+    struct _reader
+    {
+      const Byte* begin;
+      const Byte* front;
+      const Byte* end;
+
+      size_t left() const noexcept
+      {
+        return static_cast<size_t>(end - front);
+      }
+
+      size_t offset() const noexcept
+      {
+        return static_cast<size_t>(front - begin);
+      }
+    };
+
+    static _stz_impl_THREADLOCAL _reader _input;
+
+# if defined(STZ_STATS)
+#   define _stz_impl_STATS(...) __VA_ARGS__
+
+    static _stz_impl_THREADLOCAL Stats  _stats;
+    static _stz_impl_THREADLOCAL size_t _buffer_capacity;
+
+    // counts whether the expression made _buffer reallocate, an expression itself for C++11 constexpr functions
+#   define _stz_impl_REGROWTH(...)                                                         \
+      (_seiriakos_impl::_buffer_capacity = _seiriakos_impl::_buffer.capacity(), __VA_ARGS__, \
+       _seiriakos_impl::_stats.buffer_regrowths += (_seiriakos_impl::_buffer.capacity() != _seiriakos_impl::_buffer_capacity))
+
+    // counts the reallocation of the storage of 'container', if any, once the probe goes out of scope
+    template<class C>
+    struct _capacity_probe
+    {
+      const C&     container;
+      const size_t capacity;
+
+      explicit _capacity_probe(const C& container_) noexcept :
+        container(container_),
+        capacity(container_.capacity())
+      {}
+
+      ~_capacity_probe() noexcept
+      {
+        if (container.capacity() != capacity)
+        {
+          ++_stats.container_allocations;
+          _stats.container_bytes += sizeof(typename C::value_type) * container.capacity();
+        }
+      }
+    };
+
+    template<class C>
+    void _count_nodes(const size_t count_) noexcept
+    {
+      _stats.container_allocations += count_;
+      _stats.container_bytes       += sizeof(typename C::value_type) * count_;
+    }
+
+    // the Bytes handed back to the caller, a copy of 'bytes_' allocated to its size
+    _stz_impl_MAYBE_UNUSED
+    static
+    void _count_returned(const Bytes& bytes_) noexcept
+    {
+      if (not bytes_.empty())
+      {
+        ++_stats.container_allocations;
+        _stats.container_bytes += bytes_.size();
+      }
+    }
+# else
+#   define _stz_impl_STATS(...)
+#   define _stz_impl_REGROWTH(...) __VA_ARGS__
+# endif
 
 # if defined(STZ_DEBUGGING)
+    // demangled name of 'T', only computed once the trace is formatted
     template<typename T>
-    auto _underlying_name() -> const char*
+    auto _resolve_name() -> const char*
     {
       static _stz_impl_THREADLOCAL char _underlying_name_buffer[256];
 
@@ -320,70 +928,244 @@ inline namespace seiriakos
       {
         if (std::is_unsigned<T>::value)
         {
-          std::sprintf(_underlying_name_buffer, "uint%zu", sizeof(T) * 8);
+          std::snprintf(_underlying_name_buffer, sizeof(_underlying_name_buffer), "uint%zu", sizeof(T) * 8);
         }
         else
         {
-          std::sprintf(_underlying_name_buffer, "int%zu", sizeof(T) * 8);
+          std::snprintf(_underlying_name_buffer, sizeof(_underlying_name_buffer), "int%zu", sizeof(T) * 8);
         }
       }
       else if (std::is_floating_point<T>::value)
       {
-        std::sprintf(_underlying_name_buffer, "float%zu", sizeof(T) * 8);
+        std::snprintf(_underlying_name_buffer, sizeof(_underlying_name_buffer), "float%zu", sizeof(T) * 8);
       }
       else
       {
 #   if defined(__clang__) or defined(__GNUC__)
-        static _stz_impl_THREADLOCAL size_t size = sizeof(_underlying_name_buffer);
-        abi::__cxa_demangle(typeid(T).name(), _underlying_name_buffer, &size, nullptr);
+        int   status    = 0;
+        char* demangled = abi::__cxa_demangle(typeid(T).name(), nullptr, nullptr, &status);
+
+        std::snprintf(_underlying_name_buffer, sizeof(_underlying_name_buffer), "%s", demangled ? demangled : typeid(T).name());
+        std::free(demangled);
 #   else
-        std::sprintf(_underlying_name_buffer, "%s", typeid(T).name());
+        std::snprintf(_underlying_name_buffer, sizeof(_underlying_name_buffer), "%s", typeid(T).name());
 #   endif
       }
 
       return _underlying_name_buffer;
     }
 
-    _stz_impl_DECLARE_MUTEX(_dbg_mtx);
-    _stz_impl_MAYBE_UNUSED static _stz_impl_THREADLOCAL char _dbg_buf[256] = {};
+    struct _type_name
+    {
+      auto (*resolve)() -> const char*;
+    };
 
-    class _indentdebug
+    template<typename T>
+    constexpr
+    auto _underlying_name() noexcept -> _type_name
     {
-    public:
+      return _type_name{&_resolve_name<T>};
+    }
+
+    // a type name resolved lazily, a string literal or a number
+    struct _trace_argument
+    {
+      auto      (*resolve)() -> const char*;
+      const char* literal;
+      size_t      number;
+    };
+
+    constexpr
+    auto _trace_arg(const _type_name name_) noexcept -> _trace_argument
+    {
+      return _trace_argument{name_.resolve, nullptr, 0};
+    }
+
+    constexpr
+    auto _trace_arg(const char* const literal_) noexcept -> _trace_argument
+    {
+      return _trace_argument{nullptr, literal_, 0};
+    }
+
+    template<typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+    constexpr
+    auto _trace_arg(const T number_) noexcept -> _trace_argument
+    {
+      return _trace_argument{nullptr, nullptr, static_cast<size_t>(number_)};
+    }
+
+    // what one _stz_impl_IDEBUGGING(...) saw, position is _buffer.size() + _input.offset() so that its growth while the
+    // record is open is the number of bytes written when serializing and read when deserializing
+    struct _trace_record
+    {
+      const char*     format;
+      _trace_argument arguments[2];
+      unsigned        depth;
+      size_t          position;
+      size_t          size;
+    };
+
+# if not defined(STZ_TRACE_CAPACITY)
+#   define STZ_TRACE_CAPACITY 4096
+# endif
+
+    // records of one thread, appended by it without locking and formatted by flush_trace() from any thread
+    struct _trace_ring
+    {
+      static constexpr size_t capacity = STZ_TRACE_CAPACITY;
+      static constexpr size_t dropped  = ~size_t(0);
+
+      _trace_record              records[capacity];
+      std::atomic<size_t>        head      = {0}; // first record not formatted yet, advanced by flush_trace()
+      std::atomic<size_t>        published = {0}; // records of the top-level calls that returned
+      std::atomic<size_t>        drops     = {0};
+      size_t                     tail      = 0;
+      unsigned                   depth     = 0;
+
       template<typename... T>
-      _stz_impl_CONSTEXPR_CPP14
-      _indentdebug(T... arguments_) noexcept
+      auto open(const char* const format_, const T... arguments_) noexcept -> size_t
       {
-        _stz_impl_DECLARE_LOCK(_dbg_mtx);
+        const unsigned record_depth = depth++;
 
-        for (unsigned k = _depth()++; k; --k)
+        if _stz_impl_ABNORMAL((tail - head.load(std::memory_order_acquire)) == capacity)
         {
-          io::dbg << "  ";
+          drops.fetch_add(1, std::memory_order_relaxed);
+          return dropped;
         }
 
-        _stz_impl_GCC_CLANG_IGNORE("-Wformat-security", _stz_impl_GCC_CLANG_IGNORE("-Wformat-nonliteral",
-          std::sprintf(_dbg_buf, arguments_...);
-        ))
+        const _trace_argument arguments[] = {_trace_arg(arguments_)..., _trace_argument{}, _trace_argument{}};
 
-        io::dbg << _dbg_buf << std::endl;
+        _trace_record& record = records[tail % capacity];
+        record.format       = format_;
+        record.arguments[0] = arguments[0];
+        record.arguments[1] = arguments[1];
+        record.depth        = record_depth;
+        record.position     = _buffer.size() + _input.offset();
+        record.size         = 0;
+
+        return tail++;
       }
 
-      ~_indentdebug() noexcept { --_depth(); }
-    private:
-      _stz_impl_ATOMIC(unsigned)& _depth()
+      void close(const size_t index_) noexcept
       {
-        static _stz_impl_ATOMIC(unsigned) indentation = {0};
-        return indentation;
-      };
+        if _stz_impl_EXPECTED(index_ != dropped)
+        {
+          _trace_record& record   = records[index_ % capacity];
+          const size_t   position = _buffer.size() + _input.offset();
+
+          // calls that lend _buffer out, such as the parallel ones, may leave it smaller than they found it
+          record.size = (position > record.position) ? (position - record.position) : 0;
+        }
+
+        if (--depth == 0)
+        {
+          published.store(tail, std::memory_order_release);
+        }
+      }
+    };
+
+#   if __cplusplus < 201703L
+    constexpr size_t _trace_ring::capacity;
+    constexpr size_t _trace_ring::dropped;
+#   endif
+
+    _stz_impl_DECLARE_MUTEX(_trace_mtx);
+    static std::vector<std::unique_ptr<_trace_ring>> _trace_rings;
+    static std::vector<_trace_ring*>                 _trace_free; // rings of exited threads, records kept for flush_trace()
+
+    // hands the thread's ring back to _trace_free when the thread exits
+    struct _trace_owner
+    {
+      _trace_ring* ring = nullptr;
+
+      ~_trace_owner() noexcept
+      {
+        if (ring != nullptr)
+        {
+          _stz_impl_DECLARE_LOCK(_trace_mtx);
+          _trace_free.push_back(ring);
+        }
+      }
+    };
+
+    // the ring is taken from _trace_free, or created and registered, on the first record of the thread
+    _stz_impl_MAYBE_UNUSED
+    static
+    auto _trace_local() noexcept -> _trace_ring&
+    {
+      static _stz_impl_THREADLOCAL _trace_owner owner;
+
+      if _stz_impl_ABNORMAL(owner.ring == nullptr)
+      {
+        _stz_impl_DECLARE_LOCK(_trace_mtx);
+
+        if (_trace_free.empty())
+        {
+          _trace_rings.emplace_back(new _trace_ring);
+          owner.ring = _trace_rings.back().get();
+        }
+        else
+        {
+          owner.ring = _trace_free.back();
+          _trace_free.pop_back();
+        }
+      }
+
+      return *owner.ring;
+    }
+
+    class _indentdebug
+    {
+    public:
+      template<typename... T>
+      _indentdebug(const char* const format_, const T... arguments_) noexcept :
+        _index(_trace_local().open(format_, arguments_...))
+      {
+        static_assert(sizeof...(T) <= 2, "stz: _stz_impl_IDEBUGGING: at most 2 arguments are recorded.");
+      }
+
+      ~_indentdebug() noexcept { _trace_local().close(_index); }
+    private:
+      const size_t _index;
     };
 
+    // '%s' and '%zu' are replaced by the arguments in order
+    _stz_impl_MAYBE_UNUSED
+    static
+    void _format_record(std::ostream& ostream_, const _trace_record& record_, const size_t base_)
+    {
+      for (unsigned k = record_.depth; k; --k)
+      {
+        ostream_ << "  ";
+      }
+
+      const _trace_argument* argument = record_.arguments;
+
+      for (const char* character = record_.format; *character != '\0'; ++character)
+      {
+        if ((character[0] == '%') and (character[1] == 's'))
+        {
+          ostream_ << (argument->resolve ? argument->resolve() : argument->literal ? argument->literal : "");
+          ++argument;
+          ++character;
+        }
+        else if ((character[0] == '%') and (character[1] == 'z') and (character[2] == 'u'))
+        {
+          ostream_ << argument->number;
+          ++argument;
+          character += 2;
+        }
+        else
+        {
+          ostream_ << *character;
+        }
+      }
+
+      ostream_ << "  [" << record_.size << " bytes at " << (record_.position - base_) << "]\n";
+    }
+
 #   define _stz_impl_IDEBUGGING(...) _seiriakos_impl::_indentdebug _idbg(__VA_ARGS__)
-#   define _stz_impl_DEBUGGING(...)                                  \
-      [&](const char* const caller_){                                \
-        _stz_impl_DECLARE_LOCK(_impl::_dbg_mtx);                     \
-        std::sprintf(_seiriakos_impl::_dbg_buf, __VA_ARGS__);                  \
-        io::dbg << caller_ << ": " << _seiriakos_impl::_dbg_buf << std::endl; \
-      }(__func__)
+#   define _stz_impl_DEBUGGING(...)  void(_seiriakos_impl::_indentdebug(__VA_ARGS__))
 # else
 #   define _stz_impl_IDEBUGGING(...) void(0)
 #   define _stz_impl_DEBUGGING(...)  void(0)
@@ -392,11 +1174,13 @@ inline namespace seiriakos
     _stz_impl_DECLARE_MUTEX(_wrn_mtx);
     _stz_impl_MAYBE_UNUSED static _stz_impl_THREADLOCAL char _wrn_buf[256] = {};
 
-#   define _stz_impl_WARNING(...)                                             \
-      [&](const char* const caller_){                                         \
-        _stz_impl_DECLARE_LOCK(_seiriakos_impl::_wrn_mtx);                    \
-        std::sprintf(_seiriakos_impl::_wrn_buf, __VA_ARGS__);                 \
-        io::wrn << caller_ << ": " << _seiriakos_impl::_wrn_buf << std::endl; \
+    // formatted before locking, the lock only covers the write, with STZ_DEBUGGING it is traced as well
+#   define _stz_impl_WARNING(...)                                                                   \
+      [&](const char* const caller_){                                                               \
+        _stz_impl_DEBUGGING(__VA_ARGS__);                                                           \
+        std::snprintf(_seiriakos_impl::_wrn_buf, sizeof(_seiriakos_impl::_wrn_buf), __VA_ARGS__);   \
+        _stz_impl_DECLARE_LOCK(_seiriakos_impl::_wrn_mtx);                                          \
+        io::wrn << caller_ << ": " << _seiriakos_impl::_wrn_buf << '\n';                            \
       }(__func__)
 
 # if defined(STZ_UNSAFE)
@@ -483,6 +1267,64 @@ inline namespace seiriakos
         serializable_._stz_impl_drz_seq();
       }
 
+      template<typename T>
+      static constexpr
+      size_t _seq_size()
+      {
+        return typename T::_stz_impl_seq_size()();
+      }
+
+      template<typename T>
+      static _stz_impl_CONSTEXPR_CPP14
+      void _srz_raw_seq(const T& serializable_, Byte*& raw_ptr_) noexcept
+      {
+        serializable_._stz_impl_srz_raw(raw_ptr_);
+      }
+
+      template<typename T>
+      static _stz_impl_CONSTEXPR_CPP14
+      void _drz_raw_seq(T& serializable_, const Byte*& raw_ptr_) noexcept
+      {
+        serializable_._stz_impl_drz_raw(raw_ptr_);
+      }
+
+#   if defined(__cpp_impl_coroutine)
+      template<typename T>
+      static constexpr
+      bool _seq_pausable()
+      {
+        return typename T::_stz_impl_seq_pausable()();
+      }
+
+      template<typename T>
+      static
+      auto _srz_seq_steps(const T& serializable_, const size_t window_) noexcept
+      {
+        return serializable_._stz_impl_srz_steps(window_);
+      }
+
+      template<typename T, typename R>
+      static
+      void _srz_seq_replay(const T& serializable_, R& replayer_) noexcept
+      {
+        serializable_._stz_impl_srz_replay(replayer_);
+      }
+#   endif
+
+      template<typename base, typename ptr>
+      static constexpr
+      const base* _const_base(const Inheritence<base, ptr>& inheritence_) noexcept
+      {
+        return static_cast<const base*>(inheritence_.base_ptr);
+      }
+
+      template<typename base, typename ptr>
+      static constexpr
+      base* _base(const Inheritence<base, ptr>& inheritence_) noexcept
+      {
+        return static_cast<base*>(inheritence_.base_ptr);
+      }
+
       template<typename base, typename ptr>
       static
       void _srz_impl_on_base(const Inheritence<base, ptr>&& inheritence_);
@@ -496,14 +1338,14 @@ inline namespace seiriakos
     constexpr
     void _srz_impl(const type&&)
     {
-      static_assert(false, "stz: serialization: cannot serialize rvalues.");
+      static_assert(sizeof(type) == 0, "stz: serialization: cannot serialize rvalues.");
     };
 
     template<typename type>
     constexpr
     void _drz_impl(type&&)
     {
-      static_assert(false, "stz: deserialization: cannot deserialize into rvalues.");
+      static_assert(sizeof(type) == 0, "stz: deserialization: cannot deserialize into rvalues.");
     };
     
     template<typename base, typename ptr>
@@ -518,1465 +1360,5238 @@ inline namespace seiriakos
     template<unsigned size, typename type>
     void _drz_impl(Bitfield<size, type>&) noexcept = delete;
 
-    // template<typename T>
-    // void _srz_impl(const T* const data_)
-    // {
-    //   _stz_impl_IDEBUGGING("pointer to:");
-
-    //   _srz_impl(*data_);
-    // }
-
-    // template<typename T>
-    // void _drz_impl(T* const data_)
-    // {
-    //   _stz_impl_IDEBUGGING("pointer to:");
-
-    //   // if (data_ == nullptr) data_ = new T;
-
-    //   _drz_impl(*data_);
-    // }
-
     template<typename T>
     using _if_sequence = typename std::enable_if<_backdoor::_has_seq<T>() == true>::type;
 
     template<typename T>
     using _no_sequence = typename std::enable_if<_backdoor::_has_seq<T>() != true>::type;
 
-    template<typename T, typename = _if_sequence<T>>
-    constexpr
-    void _srz_impl(const T& serializable_) noexcept
+    template<typename T>
+    using _bare = typename std::remove_cv<typename std::remove_reference<T>::type>::type;
+
+    template<size_t N>
+    struct _size_list
     {
-      _stz_impl_IDEBUGGING("%s", _underlying_name<T>());
+      size_t values[N];
+    };
 
-      _seiriakos_impl::_backdoor::_srz_seq(serializable_);
+    // sum of the sizes, 0 if any of them is 0
+    template<size_t N>
+    constexpr
+    size_t _static_sum(const _size_list<N> sizes_, const size_t k_ = 0, const size_t total_ = 0) noexcept
+    {
+      return (k_ == N) ? total_
+        : (sizes_.values[k_] == 0) ? 0
+        : _static_sum(sizes_, k_ + 1, total_ + sizes_.values[k_]);
     }
 
-    template<typename T, typename = _if_sequence<T>>
+    // bytes of the run of non-zero sizes starting at 'k_'
+    template<size_t N>
     constexpr
-    void _drz_impl(T& serializable_) noexcept
+    size_t _static_run(const _size_list<N> sizes_, const size_t k_) noexcept
     {
-      _stz_impl_IDEBUGGING("%s", _underlying_name<T>());
-
-      _seiriakos_impl::_backdoor::_drz_seq(serializable_);
+      return (k_ == N) or (sizes_.values[k_] == 0) ? 0 : sizes_.values[k_] + _static_run(sizes_, k_ + 1);
     }
 
-    template<typename T, typename = _no_sequence<T>>
+    template<size_t N>
     constexpr
-    void _srz_impl(const T& data_, const size_t N_ = 1)
+    bool _starts_run(const _size_list<N> sizes_, const size_t k_) noexcept
     {
-      if (N_ > 1) _stz_impl_IDEBUGGING("%s x%zu", _underlying_name<T>(),  N_);
-      else        _stz_impl_IDEBUGGING("%s",      _underlying_name<T>());
+      return (sizes_.values[k_] != 0) and ((k_ == 0) or (sizes_.values[k_ - 1] == 0));
+    }
 
-      const _ltz_impl_RESTRICT auto data_ptr = reinterpret_cast<const Byte*>(&data_);
+    template<size_t... I>
+    struct _index_sequence {};
 
-      _buffer.insert(_buffer.end(), data_ptr, data_ptr + sizeof(T) * N_);
-    }
+    template<typename S1, typename S2>
+    struct _concat_sequence;
 
-    template<typename T, typename = _no_sequence<T>>
-    _stz_impl_CONSTEXPR_CPP14
-    void _drz_impl(T& data_, const size_t N_ = 1)
+    template<size_t... I1, size_t... I2>
+    struct _concat_sequence<_index_sequence<I1...>, _index_sequence<I2...>>
     {
-      if (N_ > 1) _stz_impl_IDEBUGGING("%s x%zu", _underlying_name<T>(),  N_);
-      else        _stz_impl_IDEBUGGING("%s",      _underlying_name<T>());
+      using type = _index_sequence<I1..., (sizeof...(I1) + I2)...>;
+    };
 
-      _stz_impl_SAFE(
-      if _stz_impl_ABNORMAL(_buffer_front >= _buffer.size())
-      {
-        return;
-      }
+    // logarithmic instantiation depth
+    template<size_t N>
+    struct _make_sequence : _concat_sequence<
+      typename _make_sequence<N/2>::type,
+      typename _make_sequence<N - N/2>::type
+    > {};
 
-      if _stz_impl_ABNORMAL((_buffer.size() - _buffer_front) < (sizeof(T) * N_))
-      {
-        return;
-      })
+    template<>
+    struct _make_sequence<0>
+    {
+      using type = _index_sequence<>;
+    };
 
-      // set data's bytes one by one from the front of the buffer
-      const auto data_ptr   = reinterpret_cast<Byte*>(&data_);
-      const auto buffer_ptr = _buffer.data() + _buffer_front;
-      std::memcpy(data_ptr, buffer_ptr, sizeof(T) * N_);
+    template<>
+    struct _make_sequence<1>
+    {
+      using type = _index_sequence<0>;
+    };
+
+    template<size_t N>
+    using _make_index_sequence = typename _make_sequence<N>::type;
+
+    // evaluates pack expansions in order
+    using _expand = int[];
+
+    template<long long MIN, long long MAX>
+    struct _enum_bounds : std::true_type
+    {
+      static_assert(MIN <= MAX, "stz: enum_range: 'MIN' must not be greater than 'MAX'.");
+
+      static constexpr long long min = MIN;
+      static constexpr long long max = MAX;
+    };
+
+# if __cplusplus < 201703L
+    template<long long MIN, long long MAX>
+    constexpr long long _enum_bounds<MIN, MAX>::min;
+
+    template<long long MIN, long long MAX>
+    constexpr long long _enum_bounds<MIN, MAX>::max;
+# endif
+
+    // declared by serialization_enum_range(...), found through ADL
+    template<typename T, typename>
+    struct _enum_hook : std::false_type {};
+
+    template<typename T>
+    struct _enum_hook<T, decltype(void(_stz_impl_enum_range(std::declval<T>())))>
+      : decltype(_stz_impl_enum_range(std::declval<T>())) {};
+
+    template<typename T>
+    using _if_enum_range = typename std::enable_if<std::is_enum<T>::value and enum_range<T>::value>::type;
+
+    template<typename T>
+    using _no_enum_range = typename std::enable_if<not (std::is_enum<T>::value and enum_range<T>::value)>::type;
 
-      _buffer_front += sizeof(T) * N_;
-    }
-    
-    template<typename base, typename ptr>
     constexpr
-    void _srz_impl(const Inheritence<base, ptr>&& inheritence_) noexcept
+    size_t _span_bytes(const unsigned long long span_) noexcept
     {
-      _backdoor::_srz_impl_on_base(std::move(inheritence_));
+      return span_ <= 0xFF ? 1 : span_ <= 0xFFFF ? 2 : span_ <= 0xFFFFFFFF ? 4 : 8;
     }
 
-    template<typename base, typename ptr>
     constexpr
-    void _drz_impl(Inheritence<base, ptr>&& inheritence_) noexcept
+    unsigned _span_bits(const unsigned long long span_) noexcept
     {
-      _backdoor::_drz_impl_on_base(std::move(inheritence_));
+      return span_ <= 1 ? 1 : 1 + _span_bits(span_ >> 1);
     }
-    
-    template<unsigned size, typename type>
+
+    template<typename T, typename = void>
+    struct _enum_span
+    {
+      static constexpr size_t   bytes = sizeof(T);
+      static constexpr unsigned bits  = 0;
+    };
+
+    // bits is 0 when packing would not save anything
+    template<typename T>
+    struct _enum_span<T, _if_enum_range<T>>
+    {
+      static constexpr unsigned long long value = static_cast<unsigned long long>(enum_range<T>::max - enum_range<T>::min);
+
+      static constexpr size_t   bytes = _span_bytes(value);
+      static constexpr unsigned bits  = (_span_bits(value) < 8 * bytes) and (_span_bits(value) <= 32) ? _span_bits(value) : 0;
+    };
+
+    template<size_t N>
+    struct _uint_of;
+
+    template<> struct _uint_of<1> { using type = uint8_t;  };
+    template<> struct _uint_of<2> { using type = uint16_t; };
+    template<> struct _uint_of<4> { using type = uint32_t; };
+    template<> struct _uint_of<8> { using type = uint64_t; };
+
+    template<typename T>
     constexpr
-    void _srz_impl(const Bitfield<size, type>&& bitfield_) noexcept
+    auto _enum_offset(const T enum_) noexcept -> unsigned long long
     {
-      _srz_impl(bitfield_.proxy);
+      return static_cast<unsigned long long>(static_cast<long long>(enum_) - enum_range<T>::min);
     }
 
-    template<unsigned size, typename type>
+    template<typename T>
     constexpr
-    void _drz_impl(Bitfield<size, type>&& bitfield_) noexcept
+    auto _enum_value(const unsigned long long offset_) noexcept -> T
     {
-      _drz_impl(bitfield_.proxy);
+      return static_cast<T>(static_cast<long long>(offset_) + enum_range<T>::min);
     }
 
-    template<typename T, size_t N1>
-    void _srz_impl(const T (&data_)[N1])
+# if __cplusplus >= 201703L
+    // converts to anything, used to count the fields of an aggregate; not to std::nullptr_t, which would make the
+    // constructors of std::shared_ptr and std::function ambiguous
+    struct _any_field
     {
-      _srz_impl(*static_cast<const T*>(data_), N1);
-    }
+      template<typename T, typename = typename std::enable_if<not std::is_same<T, std::nullptr_t>::value>::type>
+      operator T() const noexcept;
+    };
 
-    template<typename T, size_t N1>
-    void _drz_impl(T (&data_)[N1])
+    // converts to classes only, for fields like std::bitset whose constructors would also take an arithmetic value
+    struct _any_class_field
     {
-      _drz_impl(*static_cast<T*>(data_), N1);
-    }
+      template<typename T, typename = typename std::enable_if<std::is_class<T>::value>::type>
+      operator T() const noexcept;
+    };
 
-    _stz_impl_MAYBE_UNUSED
-    static
-    void _size_t_srz_impl(const size_t size_)
+    // converts to arithmetic types only, for fields like std::complex whose constructors from other classes compete
+    struct _any_arithmetic_field
     {
-#   if defined(STZ_FIXED_SERIALIZATION)
-      _srz_impl(size_);
-#   else
-      _stz_impl_IDEBUGGING("size_t");
+      template<typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+      operator T() const noexcept;
+    };
 
-      uint8_t bytes_used = 1;
-      for (size_t bytes = size_; bytes >>= 8; ++bytes_used) {}
+    // converts to the base classes of 'D' only
+    template<typename D>
+    struct _any_base
+    {
+      template<typename B, typename = typename std::enable_if<std::is_base_of<B, D>::value and not std::is_same<B, D>::value>::type>
+      operator B() const noexcept;
+    };
 
-      _buffer.push_back(static_cast<Byte>(bytes_used));
+    template<typename T, typename F, typename = void>
+    struct _brace_constructible : std::false_type {};
 
-      for (size_t bytes = size_; bytes_used; bytes >>= 8, --bytes_used)
-      {
-        _buffer.push_back(static_cast<Byte>(bytes & 0xFF));
-      }
-#   endif
-    }
+    // every field gets braces of its own, an array field then takes one initializer instead of one per element
+    // members with converting constructor templates, like std::optional, make the conversion ambiguous to -Wconversion
+    _stz_impl_GCC_IGNORE("-Wconversion",
+    template<typename T, typename... F>
+    struct _brace_constructible<T, std::tuple<F...>, decltype(void(T{{F()}...}))>
+      : std::true_type {};
+    )
 
-    _stz_impl_MAYBE_UNUSED
-    static
-    void _size_t_drz_impl(size_t& size_)
-    {
-#   if defined(STZ_FIXED_SERIALIZATION)
-      _drz_impl(size_);
-#   else
-      _stz_impl_IDEBUGGING("size_t");
+    template<typename T, typename F, typename = void>
+    struct _more_constructible : std::false_type {};
 
-      _stz_impl_SAFE(
-      if _stz_impl_ABNORMAL(_buffer_front >= _buffer.size())
-      {
-        return;
-      })
+    // one more initializer, without braces, still fits: some field could not be counted
+    _stz_impl_GCC_IGNORE("-Wconversion",
+    template<typename T, typename... F>
+    struct _more_constructible<T, std::tuple<F...>, decltype(void(T{{F()}..., _any_field()}))>
+      : std::true_type {};
+    )
 
-      uint8_t bytes_used = _buffer[_buffer_front++];
+    template<typename T, typename = void>
+    struct _has_base : std::false_type {};
 
-      _stz_impl_SAFE(
-      if _stz_impl_ABNORMAL((_buffer.size() - _buffer_front) < bytes_used)
-      {
-        return;
-      })
+    // base classes come first in the initializers of an aggregate
+    template<typename T>
+    struct _has_base<T, decltype(void(T{_any_base<T>()}))> : std::true_type {};
 
-      size_ = {};
-      for (size_t k = 0; bytes_used; k += 8, --bytes_used)
-      {
-        size_ |= (_buffer[_buffer_front++] << k);
-      }
-#   endif
-    }
+    template<typename F, typename G>
+    struct _append_field;
 
-    template<typename T>
-    constexpr
-    void _srz_impl(const std::complex<T>& complex) noexcept;
+    template<typename... F, typename G>
+    struct _append_field<std::tuple<F...>, G>
+    {
+      using type = std::tuple<F..., G>;
+    };
+
+    // how each field is initialized, fields are added as long as one of the initializers fits
+    template<typename T, typename F = std::tuple<>, int =
+      _brace_constructible<T, typename _append_field<F, _any_field>::type>::value            ? 1 :
+      _brace_constructible<T, typename _append_field<F, _any_class_field>::type>::value      ? 2 :
+      _brace_constructible<T, typename _append_field<F, _any_arithmetic_field>::type>::value ? 3 : 0
+    >
+    struct _field_count : _field_count<T, typename _append_field<F, _any_field>::type> {};
 
+    template<typename T, typename F>
+    struct _field_count<T, F, 2> : _field_count<T, typename _append_field<F, _any_class_field>::type> {};
+
+    template<typename T, typename F>
+    struct _field_count<T, F, 3> : _field_count<T, typename _append_field<F, _any_arithmetic_field>::type> {};
+
+    template<typename T, typename... F>
+    struct _field_count<T, std::tuple<F...>, 0> : std::integral_constant<size_t, sizeof...(F)>
+    {
+      static constexpr bool exact = not _more_constructible<T, std::tuple<F...>>::value;
+    };
+
+    // the library's own wrappers and std::array are aggregates as well, but have overloads of their own
     template<typename T>
-    constexpr
-    void _drz_impl(std::complex<T>& complex) noexcept;
+    struct _is_wrapper : std::false_type {};
+
+    template<typename T, size_t N>
+    struct _is_wrapper<std::array<T, N>> : std::true_type {};
+
+    template<class base, typename ptr>
+    struct _is_wrapper<Inheritence<base, ptr>> : std::true_type {};
+
+    template<unsigned size, typename T>
+    struct _is_wrapper<Bitfield<size, T>> : std::true_type {};
 
     template<typename T>
-    constexpr
-    void _srz_impl(const std::atomic<T>& atomic) noexcept;
+    struct _is_wrapper<RunLength<T>> : std::true_type {};
 
     template<typename T>
-    constexpr
-    void _drz_impl(std::atomic<T>& atomic) noexcept;
+    struct _is_wrapper<NodeReuse<T>> : std::true_type {};
 
     template<typename T>
-    _stz_impl_CONSTEXPR_CPP14
-    void _srz_impl(const std::basic_string<T>& string) noexcept;
+    struct _is_wrapper<Chunked<T>> : std::true_type {};
 
+    // plain aggregates are serialized without serialization_sequential(...)
     template<typename T>
-    _stz_impl_CONSTEXPR_CPP14
-    void _drz_impl(std::basic_string<T>& string) noexcept;
+    struct _is_aggregate : std::integral_constant<bool,
+      std::is_aggregate<T>::value and std::is_class<T>::value and (_backdoor::_has_seq<T>() == false)
+      and not _is_wrapper<T>::value
+    > {};
 
-    template<typename T, size_t N1>
-    _stz_impl_CONSTEXPR_CPP14
-    void _srz_impl(const std::array<T, N1>& array) noexcept;
+    // structured bindings need every field counted and in the aggregate itself, not in a base class
+    template<typename T>
+    struct _has_tied_fields : std::integral_constant<bool,
+      not _has_base<T>::value and _field_count<T>::exact and _field_count<T>::value <= 32
+    > {};
 
-    template<typename T, size_t N1>
-    _stz_impl_CONSTEXPR_CPP14
-    void _drz_impl(std::array<T, N1>& array) noexcept;
+    // references to the fields of an aggregate without base classes nor bit-fields
+    template<typename T>
+    constexpr
+    auto _tie_fields(T& aggregate_) noexcept
+    {
+      constexpr size_t N = _field_count<_bare<T>>::value;
+
+      static_assert(N <= 32, "stz: aggregates of more than 32 fields need serialization_sequential(...).");
+
+      if constexpr (N == 0) { return std::tie(); }
+      else if constexpr (N == 1) { auto& [f0] = aggregate_; return std::tie(f0); }
+      else if constexpr (N == 2) { auto& [f0, f1] = aggregate_; return std::tie(f0, f1); }
+      else if constexpr (N == 3) { auto& [f0, f1, f2] = aggregate_; return std::tie(f0, f1, f2); }
+      else if constexpr (N == 4) { auto& [f0, f1, f2, f3] = aggregate_; return std::tie(f0, f1, f2, f3); }
+      else if constexpr (N == 5) { auto& [f0, f1, f2, f3, f4] = aggregate_; return std::tie(f0, f1, f2, f3, f4); }
+      else if constexpr (N == 6) { auto& [f0, f1, f2, f3, f4, f5] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5); }
+      else if constexpr (N == 7) { auto& [f0, f1, f2, f3, f4, f5, f6] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6); }
+      else if constexpr (N == 8) { auto& [f0, f1, f2, f3, f4, f5, f6, f7] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7); }
+      else if constexpr (N == 9) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8); }
+      else if constexpr (N == 10) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9); }
+      else if constexpr (N == 11) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10); }
+      else if constexpr (N == 12) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11); }
+      else if constexpr (N == 13) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12); }
+      else if constexpr (N == 14) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13); }
+      else if constexpr (N == 15) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14); }
+      else if constexpr (N == 16) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15); }
+      else if constexpr (N == 17) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16); }
+      else if constexpr (N == 18) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17); }
+      else if constexpr (N == 19) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18); }
+      else if constexpr (N == 20) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19); }
+      else if constexpr (N == 21) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20); }
+      else if constexpr (N == 22) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21); }
+      else if constexpr (N == 23) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22); }
+      else if constexpr (N == 24) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23); }
+      else if constexpr (N == 25) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24); }
+      else if constexpr (N == 26) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25); }
+      else if constexpr (N == 27) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26); }
+      else if constexpr (N == 28) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27); }
+      else if constexpr (N == 29) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28); }
+      else if constexpr (N == 30) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29); }
+      else if constexpr (N == 31) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30); }
+      else if constexpr (N == 32) { auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31] = aggregate_; return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31); }
+    }
 
     template<typename T>
-    _stz_impl_CONSTEXPR_CPP14
-    void _srz_impl(const std::vector<T>& vector) noexcept;
+    struct _is_bytewise_aggregate;
 
+    // fields whose bytes are their serialization: pointers go through the pointer table and ranged enumerations are
+    // written as offsets instead
     template<typename T>
-    _stz_impl_CONSTEXPR_CPP14
-    void _drz_impl(std::vector<T>& vector) noexcept;
+    struct _is_bytewise_field : std::disjunction<
+      std::is_arithmetic<T>,
+      std::conjunction<std::is_enum<T>, std::negation<enum_range<T>>>,
+      _is_bytewise_aggregate<T>
+    > {};
 
-    inline
-    void _srz_impl(const std::vector<bool>& vector) noexcept;
+    // arrays of such fields are laid out without padding
+    template<typename T, size_t N>
+    struct _is_bytewise_field<std::array<T, N>> : _is_bytewise_field<T> {};
 
-    inline
-    void _drz_impl(std::vector<bool>& vector) noexcept;
+    template<typename T, size_t N>
+    struct _is_bytewise_field<T[N]> : _is_bytewise_field<T> {};
 
-    template<typename T>
-    _stz_impl_CONSTEXPR_CPP14
-    void _srz_impl(const std::valarray<T>& valarray) noexcept;
+    template<typename F>
+    struct _are_bytewise_fields;
 
-    template<typename T>
-    _stz_impl_CONSTEXPR_CPP14
-    void _drz_impl(std::valarray<T>& valarray) noexcept;
+    template<typename... F>
+    struct _are_bytewise_fields<std::tuple<F&...>> : std::conjunction<_is_bytewise_field<std::remove_cv_t<F>>...>
+    {
+      static constexpr size_t size = (sizeof(F) + ... + 0);
+    };
 
-    template<size_t N1>
-    _stz_impl_CONSTEXPR_CPP14
-    void _srz_impl(const std::bitset<N1>& bitset) noexcept;
+    // the fields must also fill the aggregate, padding bytes would make equal values serialize differently
+    template<typename T, bool = _has_tied_fields<T>::value>
+    struct _inspect_fields
+    {
+      using fields = _are_bytewise_fields<decltype(_tie_fields(std::declval<T&>()))>;
 
-    template<size_t N1>
-    _stz_impl_CONSTEXPR_CPP14
-    void _drz_impl(std::bitset<N1>& bitset) noexcept;
+      static constexpr bool value = fields::value and (fields::size == sizeof(T));
+    };
 
+    // fields that cannot be tied, behind base classes or past 32, are not inspected: the trivially copyable aggregate
+    // is copied whole, padding and pointers included
     template<typename T>
-    constexpr
-    void _srz_impl(const std::list<T>& list) noexcept;
+    struct _inspect_fields<T, false> : std::true_type {};
 
     template<typename T>
-    constexpr
-    void _drz_impl(std::list<T>& list) noexcept;
+    struct _has_bytewise_fields : std::integral_constant<bool, _inspect_fields<T>::value> {};
 
+    // their bytes are copied as is
     template<typename T>
-    constexpr
-    void _srz_impl(const std::stack<T>& stack) noexcept;
+    struct _is_bytewise_aggregate : std::conjunction<
+      _is_aggregate<T>,
+      std::is_trivially_copyable<T>,
+      _has_bytewise_fields<T>
+    > {};
 
+    // their fields are serialized one by one
     template<typename T>
-    constexpr
-    void _drz_impl(std::stack<T>& stack) noexcept;
+    struct _is_reflected : std::integral_constant<bool,
+      _is_aggregate<T>::value and not _is_bytewise_aggregate<T>::value
+    > {};
+# else
+    template<typename T>
+    struct _is_bytewise_aggregate : std::false_type {};
 
     template<typename T>
-    constexpr
-    void _srz_impl(const std::forward_list<T>& forward_list) noexcept;
+    struct _is_reflected : std::false_type {};
+# endif
 
     template<typename T>
-    constexpr
-    void _drz_impl(std::forward_list<T>& forward_list) noexcept;
+    using _if_reflected = typename std::enable_if<_is_reflected<T>::value>::type;
 
-    template<typename T, typename S>
-    constexpr
-    void _srz_impl(const std::queue<T, S>& queue) noexcept;
+    // neither a ranged enumeration nor a reflected aggregate, its bytes are copied as is
+    template<typename T>
+    using _if_bytewise = typename std::enable_if<
+      not (std::is_enum<T>::value and enum_range<T>::value) and not _is_reflected<T>::value
+    >::type;
+
+    // whether a 'T' built for a container of allocator 'A' has parts that should use that allocator
+    template<typename T, typename A, typename = void>
+    struct _needs_allocator : std::uses_allocator<T, A> {};
+
+    template<typename T1, typename T2, typename A>
+    struct _needs_allocator<std::pair<T1, T2>, A> : std::integral_constant<bool,
+      _needs_allocator<T1, A>::value or _needs_allocator<T2, A>::value
+    > {};
+
+    // builds a 'T' with 'allocator_', aggregates and pairs field by field, to deserialize into
+    template<typename T, typename A, typename = void>
+    struct _allocated
+    {
+      static auto _make(const A&) -> T
+      {
+        return T();
+      }
+    };
 
-    template<typename T, typename S>
-    constexpr
-    void _drz_impl(std::queue<T, S>& queue) noexcept;
+    template<typename T, typename A>
+    struct _allocated<T, A, typename std::enable_if<
+      std::uses_allocator<T, A>::value and std::is_constructible<T, std::allocator_arg_t, const A&>::value
+    >::type>
+    {
+      static auto _make(const A& allocator_) -> T
+      {
+        return T(std::allocator_arg, allocator_);
+      }
+    };
 
-    template<typename T, class C, class F>
-    constexpr
-    void _srz_impl(const std::priority_queue<T, C, F>& priority_queue) noexcept;
+    template<typename T, typename A>
+    struct _allocated<T, A, typename std::enable_if<
+      std::uses_allocator<T, A>::value and not std::is_constructible<T, std::allocator_arg_t, const A&>::value
+      and std::is_constructible<T, const A&>::value
+    >::type>
+    {
+      static auto _make(const A& allocator_) -> T
+      {
+        return T(allocator_);
+      }
+    };
 
-    template<typename T, class C, class F>
-    _stz_impl_CONSTEXPR_CPP14
-    void _drz_impl(std::priority_queue<T, C, F>& priority_queue) noexcept;
+    template<typename T1, typename T2, typename A>
+    struct _allocated<std::pair<T1, T2>, A>
+    {
+      static auto _make(const A& allocator_) -> std::pair<T1, T2>
+      {
+        return std::pair<T1, T2>(_allocated<T1, A>::_make(allocator_), _allocated<T2, A>::_make(allocator_));
+      }
+    };
+
+# if __cplusplus >= 201703L
+    template<typename F, typename A>
+    struct _fields_need_allocator;
+
+    template<typename... F, typename A>
+    struct _fields_need_allocator<std::tuple<F&...>, A> : std::disjunction<_needs_allocator<std::remove_cv_t<F>, A>...> {};
 
+    // _field_count<T> is only instantiated for aggregates
     template<typename T, typename A>
-    constexpr
-    void _srz_impl(const std::deque<T, A>& deque) noexcept;
+    struct _needs_allocator<T, A, std::enable_if_t<std::conjunction_v<_is_reflected<T>, _has_tied_fields<T>>>>
+      : _fields_need_allocator<decltype(_tie_fields(std::declval<T&>())), A> {};
 
     template<typename T, typename A>
-    constexpr
-    void _drz_impl(std::deque<T, A>& deque) noexcept;
+    struct _allocated<T, A, std::enable_if_t<std::conjunction_v<_is_reflected<T>, _needs_allocator<T, A>>>>
+    {
+      template<typename... F>
+      static auto _make(const A& allocator_, std::tuple<F&...>*) -> T
+      {
+        // array fields cannot be initialized from a value
+        if constexpr ((std::is_array<F>::value or ...))
+        {
+          return T();
+        }
+        else
+        {
+          return T{_allocated<std::remove_cv_t<F>, A>::_make(allocator_)...};
+        }
+      }
 
-    template<typename T1, typename T2>
-    constexpr
-    void _srz_impl(const std::pair<T1, T2>& pair) noexcept;
+      static auto _make(const A& allocator_) -> T
+      {
+        return _make(allocator_, static_cast<decltype(_tie_fields(std::declval<T&>()))*>(nullptr));
+      }
+    };
+# endif
 
-    template<typename T1, typename T2>
-    constexpr
-    void _drz_impl(std::pair<T1, T2>& pair) noexcept;
+    // elements that hold allocator-aware parts without being allocator-aware themselves, their containers would build
+    // them with the default allocator
+    template<typename C>
+    struct _holds_allocator : std::integral_constant<bool,
+      _needs_allocator<typename C::value_type, typename C::allocator_type>::value
+      and not std::uses_allocator<typename C::value_type, typename C::allocator_type>::value
+    > {};
 
-    template<typename T1, typename T2>
-    constexpr
-    void _srz_impl(const std::unordered_map<T1, T2>& unordered_map) noexcept;
+    template<typename C>
+    auto _make_element(const C& container_) -> typename C::value_type
+    {
+      return _allocated<typename C::value_type, typename C::allocator_type>::_make(container_.get_allocator());
+    }
 
-    template<typename T1, typename T2>
-    constexpr
-    void _drz_impl(std::unordered_map<T1, T2>& unordered_map) noexcept;
+    // serialized size known at compile time, 0 if it depends on the value
+    template<typename T, typename = void>
+    struct _static_size : std::integral_constant<size_t, _is_bytewise_aggregate<T>::value ? sizeof(T) : 0> {};
 
-    template<typename T1, typename T2>
-    constexpr
-    void _srz_impl(const std::unordered_multimap<T1, T2>& unordered_multimap) noexcept;
+    template<typename... T>
+    struct _static_size_many : std::integral_constant<size_t,
+      _static_sum(_size_list<sizeof...(T)>{{_static_size<T>::value...}})
+    > {};
 
-    template<typename T1, typename T2>
-    constexpr
-    void _drz_impl(std::unordered_multimap<T1, T2>& unordered_multimap) noexcept;
+    template<>
+    struct _static_size_many<> : std::integral_constant<size_t, 0> {};
 
-    template<typename T1, typename T2>
-    constexpr
-    void _srz_impl(const std::map<T1, T2>& map) noexcept;
+    template<typename T>
+    struct _static_size<T, typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type>
+      : std::integral_constant<size_t, _enum_span<T>::bytes> {};
 
-    template<typename T1, typename T2>
-    constexpr
-    void _drz_impl(std::map<T1, T2>& map) noexcept;
+    template<typename T>
+    struct _static_size<T, _if_sequence<T>>
+      : std::integral_constant<size_t, _backdoor::_seq_size<T>()> {};
 
-    template<typename T1, typename T2>
-    constexpr
-    void _srz_impl(const std::multimap<T1, T2>& multimap) noexcept;
+    template<typename T, size_t N1>
+    struct _static_size<T[N1]> : std::integral_constant<size_t, N1 * _static_size<T>::value> {};
+
+    template<typename T, size_t N1>
+    struct _static_size<std::array<T, N1>> : std::integral_constant<size_t, N1 * _static_size<T>::value> {};
+
+    template<typename T>
+    struct _static_size<std::complex<T>> : std::integral_constant<size_t, 2 * _static_size<T>::value> {};
+
+    template<size_t N1>
+    struct _static_size<std::bitset<N1>> : std::integral_constant<size_t, sizeof(std::bitset<N1>)> {};
 
     template<typename T1, typename T2>
-    constexpr
-    void _drz_impl(std::multimap<T1, T2>& multimap) noexcept;
+    struct _static_size<std::pair<T1, T2>> : _static_size_many<T1, T2> {};
+
+    template<typename... T>
+    struct _static_size<std::tuple<T...>> : _static_size_many<T...> {};
+
+    template<unsigned size, typename T>
+    struct _static_size<Bitfield<size, T>> : _static_size<T> {};
+
+    template<typename base, typename ptr>
+    struct _static_size<Inheritence<base, ptr>> : _static_size<base> {};
+
+# if __cplusplus >= 201703L
+    template<>
+    struct _static_size<std::monostate> : std::integral_constant<size_t, 0> {};
+# endif
+
+    // only used in unevaluated contexts by serialization_sequential(...), from a member function body so that the
+    // members it names may be declared after it
+    template<typename... T>
+    auto _static_size_of(T&&...) noexcept -> _static_size_many<_bare<T>...>;
 
     template<typename T>
-    constexpr
-    void _srz_impl(const std::unordered_set<T>& unordered_set) noexcept;
+    using _if_static = typename std::enable_if<_static_size<_bare<T>>::value != 0>::type;
 
     template<typename T>
-    constexpr
-    void _drz_impl(std::unordered_set<T>& unordered_set) noexcept;
+    using _no_static = typename std::enable_if<_static_size<_bare<T>>::value == 0>::type;
 
     template<typename T>
-    constexpr
-    void _srz_impl(const std::unordered_multiset<T>& unordered_multiset) noexcept;
+    struct _is_raw_leaf : std::integral_constant<bool,
+      std::is_arithmetic<T>::value || (std::is_enum<T>::value and not enum_range<T>::value) || _is_bytewise_aggregate<T>::value
+    > {};
 
     template<typename T>
-    constexpr
-    void _drz_impl(std::unordered_multiset<T>& unordered_multiset) noexcept;
+    using _if_raw_leaf = typename std::enable_if<_is_raw_leaf<T>::value>::type;
 
     template<typename T>
-    constexpr
-    void _srz_impl(const std::set<T>& set) noexcept;
+    using _if_raw_sequence = typename std::enable_if<
+      _backdoor::_has_seq<T>() == true and _static_size<T>::value != 0
+    >::type;
 
+    // raw writes go through a pointer into storage that was bounded beforehand
     template<typename T>
-    constexpr
-    void _drz_impl(std::set<T>& set) noexcept;
+    auto _srz_raw(Byte*& raw_ptr, const T& data) noexcept -> _if_raw_leaf<T>;
 
     template<typename T>
-    constexpr
-    void _srz_impl(const std::multiset<T>& multiset) noexcept;
+    auto _drz_raw(const Byte*& raw_ptr, T& data) noexcept -> _if_raw_leaf<T>;
 
     template<typename T>
-    constexpr
-    void _drz_impl(std::multiset<T>& multiset) noexcept;
+    auto _srz_raw(Byte*& raw_ptr, const T& enumeration) noexcept -> _if_enum_range<T>;
 
-    template<typename... T>
-    constexpr
-    void _srz_impl(const std::tuple<T...>& tuple) noexcept;
+    template<typename T>
+    auto _drz_raw(const Byte*& raw_ptr, T& enumeration) noexcept -> _if_enum_range<T>;
 
-    template<typename... T>
-    constexpr
-    void _drz_impl(std::tuple<T...>& tuple) noexcept;
+    template<typename T>
+    auto _srz_raw(Byte*& raw_ptr, const T& serializable) noexcept -> _if_raw_sequence<T>;
 
     template<typename T>
-    using _if_fundamental = typename std::enable_if<std::is_fundamental<T>::value == true>::type;
+    auto _drz_raw(const Byte*& raw_ptr, T& serializable) noexcept -> _if_raw_sequence<T>;
 
     template<typename T>
-    using _no_fundamental = typename std::enable_if<std::is_fundamental<T>::value != true>::type;
+    auto _srz_raw(Byte*&, const T&) noexcept -> _no_static<T>;
 
-    template<typename T, typename = _if_fundamental<T>>
-    _stz_impl_CONSTEXPR_CPP14
-    void _srz_impl_many_fundamentals(const T& things_, const size_t count_) noexcept
-    {
-      _srz_impl(things_, count_);
-    }
+    template<typename T>
+    auto _drz_raw(const Byte*&, T&&) noexcept -> _no_static<T>;
 
-    template<typename T, typename = _no_fundamental<T>>
-    constexpr
-    void _srz_impl_many_fundamentals(const T&, const size_t, ...) noexcept
-    {}
+    template<typename T, size_t N1>
+    void _srz_raw(Byte*& raw_ptr, const T (&data)[N1]) noexcept;
 
-    template<typename T, typename = _if_fundamental<T>>
-    _stz_impl_CONSTEXPR_CPP14
-    void _drz_impl_many_fundamentals(T& things_, const size_t count_) noexcept
-    {
-      _drz_impl(things_, count_);
-    }
+    template<typename T, size_t N1>
+    void _drz_raw(const Byte*& raw_ptr, T (&data)[N1]) noexcept;
 
-    template<typename T, typename = _no_fundamental<T>>
-    constexpr
-    void _drz_impl_many_fundamentals(T&, const size_t, ...) noexcept
-    {}
+    template<typename T, size_t N1>
+    void _srz_raw(Byte*& raw_ptr, const std::array<T, N1>& array) noexcept;
+
+    template<typename T, size_t N1>
+    void _drz_raw(const Byte*& raw_ptr, std::array<T, N1>& array) noexcept;
+
+    template<typename T>
+    void _srz_raw(Byte*& raw_ptr, const std::complex<T>& complex) noexcept;
+
+    template<typename T>
+    void _drz_raw(const Byte*& raw_ptr, std::complex<T>& complex) noexcept;
+
+    template<size_t N1>
+    void _srz_raw(Byte*& raw_ptr, const std::bitset<N1>& bitset) noexcept;
+
+    template<size_t N1>
+    void _drz_raw(const Byte*& raw_ptr, std::bitset<N1>& bitset) noexcept;
+
+    template<typename T1, typename T2>
+    void _srz_raw(Byte*& raw_ptr, const std::pair<T1, T2>& pair) noexcept;
+
+    template<typename T1, typename T2>
+    void _drz_raw(const Byte*& raw_ptr, std::pair<T1, T2>& pair) noexcept;
+
+    template<typename... T>
+    void _srz_raw(Byte*& raw_ptr, const std::tuple<T...>& tuple) noexcept;
+
+    template<typename... T>
+    void _drz_raw(const Byte*& raw_ptr, std::tuple<T...>& tuple) noexcept;
+
+    template<unsigned size, typename T>
+    void _srz_raw(Byte*& raw_ptr, const Bitfield<size, T>& bitfield) noexcept;
+
+    template<unsigned size, typename T>
+    void _drz_raw(const Byte*& raw_ptr, Bitfield<size, T>&& bitfield) noexcept;
 
     template<typename base, typename ptr>
-    void _backdoor::_srz_impl_on_base(const Inheritence<base, ptr>&& inheritence_)
-    {
-      _srz_impl(*static_cast<const base*>(inheritence_.base_ptr));
-    }
+    void _srz_raw(Byte*& raw_ptr, const Inheritence<base, ptr>& inheritence) noexcept;
 
     template<typename base, typename ptr>
-    void _backdoor::_drz_impl_on_base(Inheritence<base, ptr>&& inheritence_)
-    {
-      _drz_impl(*static_cast<base*>(inheritence_.base_ptr));
-    }
+    void _drz_raw(const Byte*& raw_ptr, Inheritence<base, ptr>&& inheritence) noexcept;
 
-    template<typename T, typename... T_>
-    constexpr
-    auto _sizeof_many() noexcept -> typename std::enable_if<sizeof...(T_) == 0, size_t>::type
+    template<typename T>
+    auto _srz_raw(Byte*& raw_ptr_, const T& data_) noexcept -> _if_raw_leaf<T>
     {
-      return sizeof(T);
+      std::memcpy(raw_ptr_, &data_, sizeof(T));
+      raw_ptr_ += sizeof(T);
     }
 
-    template<typename T, typename... T_>
-    constexpr
-    auto _sizeof_many() noexcept -> typename std::enable_if<sizeof...(T_) != 0, size_t>::type
+    template<typename T>
+    auto _drz_raw(const Byte*& raw_ptr_, T& data_) noexcept -> _if_raw_leaf<T>
     {
-      return sizeof(T) + _sizeof_many<T_...>();
+      std::memcpy(&data_, raw_ptr_, sizeof(T));
+      raw_ptr_ += sizeof(T);
     }
 
+    // values outside the range would be truncated and then skipped on load, they are written as the minimum instead
     template<typename T>
-    using _strip = typename std::remove_reference<T>::type;
+    auto _srz_enum_offset(const T enum_) noexcept -> unsigned long long
+    {
+      const unsigned long long offset = _enum_offset(enum_);
+
+      _stz_impl_SAFE(
+      if _stz_impl_ABNORMAL(offset > _enum_span<T>::value)
+      {
+        _stz_impl_WARNING("enumeration value outside its enum_range, written as the range's minimum.");
+
+        return 0;
+      })
+
+      return offset;
+    }
+
+    // offset from the minimum of the range, on as few bytes as the range allows
+    template<typename T>
+    auto _srz_raw(Byte*& raw_ptr_, const T& enumeration_) noexcept -> _if_enum_range<T>
+    {
+      const auto offset = static_cast<typename _uint_of<_enum_span<T>::bytes>::type>(_srz_enum_offset(enumeration_));
+
+      std::memcpy(raw_ptr_, &offset, sizeof(offset));
+      raw_ptr_ += sizeof(offset);
+    }
+
+    template<typename T>
+    auto _drz_raw(const Byte*& raw_ptr_, T& enumeration_) noexcept -> _if_enum_range<T>
+    {
+      typename _uint_of<_enum_span<T>::bytes>::type offset;
+
+      std::memcpy(&offset, raw_ptr_, sizeof(offset));
+      raw_ptr_ += sizeof(offset);
+
+      _stz_impl_SAFE(
+      if _stz_impl_ABNORMAL(offset > _enum_span<T>::value)
+      {
+        return;
+      })
+
+      enumeration_ = _enum_value<T>(offset);
+    }
+
+    template<typename T>
+    auto _srz_raw(Byte*& raw_ptr_, const T& serializable_) noexcept -> _if_raw_sequence<T>
+    {
+      _backdoor::_srz_raw_seq(serializable_, raw_ptr_);
+    }
+
+    template<typename T>
+    auto _drz_raw(const Byte*& raw_ptr_, T& serializable_) noexcept -> _if_raw_sequence<T>
+    {
+      _backdoor::_drz_raw_seq(serializable_, raw_ptr_);
+    }
+
+    // never reached, types without a static size are not written through raw pointers
+    template<typename T>
+    auto _srz_raw(Byte*&, const T&) noexcept -> _no_static<T>
+    {}
+
+    template<typename T>
+    auto _drz_raw(const Byte*&, T&&) noexcept -> _no_static<T>
+    {}
+
+    template<typename T, size_t N1>
+    void _srz_raw(Byte*& raw_ptr_, const T (&data_)[N1]) noexcept
+    {
+      for (const auto& value : data_)
+      {
+        _srz_raw(raw_ptr_, value);
+      }
+    }
+
+    template<typename T, size_t N1>
+    void _drz_raw(const Byte*& raw_ptr_, T (&data_)[N1]) noexcept
+    {
+      for (auto& value : data_)
+      {
+        _drz_raw(raw_ptr_, value);
+      }
+    }
+
+    template<typename T, size_t N1>
+    void _srz_raw(Byte*& raw_ptr_, const std::array<T, N1>& array_) noexcept
+    {
+      for (const auto& value : array_)
+      {
+        _srz_raw(raw_ptr_, value);
+      }
+    }
+
+    template<typename T, size_t N1>
+    void _drz_raw(const Byte*& raw_ptr_, std::array<T, N1>& array_) noexcept
+    {
+      for (auto& value : array_)
+      {
+        _drz_raw(raw_ptr_, value);
+      }
+    }
+
+    template<typename T>
+    void _srz_raw(Byte*& raw_ptr_, const std::complex<T>& complex_) noexcept
+    {
+      _srz_raw(raw_ptr_, complex_.real());
+      _srz_raw(raw_ptr_, complex_.imag());
+    }
+
+    template<typename T>
+    void _drz_raw(const Byte*& raw_ptr_, std::complex<T>& complex_) noexcept
+    {
+      T value = {};
+      _drz_raw(raw_ptr_, value);
+      complex_.real(value);
+      _drz_raw(raw_ptr_, value);
+      complex_.imag(value);
+    }
+
+    template<size_t N1>
+    void _srz_raw(Byte*& raw_ptr_, const std::bitset<N1>& bitset_) noexcept
+    {
+      std::memcpy(raw_ptr_, &bitset_, sizeof(bitset_));
+      raw_ptr_ += sizeof(bitset_);
+    }
+
+    template<size_t N1>
+    void _drz_raw(const Byte*& raw_ptr_, std::bitset<N1>& bitset_) noexcept
+    {
+      std::memcpy(&bitset_, raw_ptr_, sizeof(bitset_));
+      raw_ptr_ += sizeof(bitset_);
+    }
+
+    template<typename T1, typename T2>
+    void _srz_raw(Byte*& raw_ptr_, const std::pair<T1, T2>& pair_) noexcept
+    {
+      _srz_raw(raw_ptr_, pair_.first);
+      _srz_raw(raw_ptr_, pair_.second);
+    }
+
+    template<typename T1, typename T2>
+    void _drz_raw(const Byte*& raw_ptr_, std::pair<T1, T2>& pair_) noexcept
+    {
+      _drz_raw(raw_ptr_, pair_.first);
+      _drz_raw(raw_ptr_, pair_.second);
+    }
+
+    template<typename... T, size_t... I>
+    void _srz_raw_tuple(Byte*& raw_ptr_, const std::tuple<T...>& tuple_, _index_sequence<I...>) noexcept
+    {
+      (void)_expand{0, (_srz_raw(raw_ptr_, std::get<I>(tuple_)), 0)...};
+    }
+
+    template<typename... T, size_t... I>
+    void _drz_raw_tuple(const Byte*& raw_ptr_, std::tuple<T...>& tuple_, _index_sequence<I...>) noexcept
+    {
+      (void)_expand{0, (_drz_raw(raw_ptr_, std::get<I>(tuple_)), 0)...};
+    }
+
+    template<typename... T>
+    void _srz_raw(Byte*& raw_ptr_, const std::tuple<T...>& tuple_) noexcept
+    {
+      _srz_raw_tuple(raw_ptr_, tuple_, _make_index_sequence<sizeof...(T)>());
+    }
+
+    template<typename... T>
+    void _drz_raw(const Byte*& raw_ptr_, std::tuple<T...>& tuple_) noexcept
+    {
+      _drz_raw_tuple(raw_ptr_, tuple_, _make_index_sequence<sizeof...(T)>());
+    }
+
+    template<unsigned size, typename T>
+    void _srz_raw(Byte*& raw_ptr_, const Bitfield<size, T>& bitfield_) noexcept
+    {
+      _srz_raw(raw_ptr_, bitfield_.proxy);
+    }
+
+    template<unsigned size, typename T>
+    void _drz_raw(const Byte*& raw_ptr_, Bitfield<size, T>&& bitfield_) noexcept
+    {
+      _drz_raw(raw_ptr_, bitfield_.proxy);
+    }
+
+    template<typename base, typename ptr>
+    void _srz_raw(Byte*& raw_ptr_, const Inheritence<base, ptr>& inheritence_) noexcept
+    {
+      _srz_raw(raw_ptr_, *_backdoor::_const_base(inheritence_));
+    }
+
+    template<typename base, typename ptr>
+    void _drz_raw(const Byte*& raw_ptr_, Inheritence<base, ptr>&& inheritence_) noexcept
+    {
+      _drz_raw(raw_ptr_, *_backdoor::_base(inheritence_));
+    }
+
+    inline
+    void _srz_raw_dispatch(Byte*&) noexcept {}
+
+    template<typename T, typename... T_>
+    void _srz_raw_dispatch(Byte*& raw_ptr_, T&& thing_, T_&&... things_) noexcept
+    {
+      _srz_raw(raw_ptr_, std::forward<const T>(thing_));
+      _srz_raw_dispatch(raw_ptr_, std::forward<const T_>(things_)...);
+    }
+
+    inline
+    void _drz_raw_dispatch(const Byte*&) noexcept {}
+
+    template<typename T, typename... T_>
+    void _drz_raw_dispatch(const Byte*& raw_ptr_, T&& thing_, T_&&... things_) noexcept
+    {
+      _drz_raw(raw_ptr_, std::forward<T>(thing_));
+      _drz_raw_dispatch(raw_ptr_, std::forward<T_>(things_)...);
+    }
+
+    // bound the buffer once for the whole object, then write through a single pointer
+    template<typename T>
+    void _srz_static(const T& thing_) noexcept
+    {
+      const size_t front = _buffer.size();
+      _stz_impl_REGROWTH(_buffer.resize(front + _static_size<T>::value));
+
+      Byte* raw_ptr = _buffer.data() + front;
+      _srz_raw(raw_ptr, thing_);
+    }
+
+    // check the bounds once for the whole object, then read through a single pointer
+    template<typename T>
+    void _drz_static(T& thing_) noexcept
+    {
+      _stz_impl_SAFE(
+      if _stz_impl_ABNORMAL(_input.left() < _static_size<T>::value)
+      {
+        return;
+      })
+
+      const Byte* raw_ptr = _input.front;
+      _drz_raw(raw_ptr, thing_);
+
+      _input.front += _static_size<T>::value;
+    }
+
+    template<typename T, typename = _if_sequence<T>>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const T& serializable_) noexcept
+    {
+      _stz_impl_IDEBUGGING("%s", _underlying_name<T>());
+
+      if _stz_impl_CONSTEXPR_CPP17 (_static_size<T>::value != 0)
+      {
+        _srz_static(serializable_);
+      }
+      else
+      {
+        _seiriakos_impl::_backdoor::_srz_seq(serializable_);
+      }
+    }
+
+    template<typename T, typename = _if_sequence<T>>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(T& serializable_) noexcept
+    {
+      _stz_impl_IDEBUGGING("%s", _underlying_name<T>());
+
+      if _stz_impl_CONSTEXPR_CPP17 (_static_size<T>::value != 0)
+      {
+        _drz_static(serializable_);
+      }
+      else
+      {
+        _seiriakos_impl::_backdoor::_drz_seq(serializable_);
+      }
+    }
+
+    template<typename T, typename = _no_sequence<T>, typename = _if_bytewise<T>>
+    constexpr
+    void _srz_impl(const T& data_, const size_t N_ = 1)
+    {
+      _stz_impl_IDEBUGGING((N_ > 1) ? "%s x%zu" : "%s", _underlying_name<T>(), N_);
+
+      const _ltz_impl_RESTRICT auto data_ptr = reinterpret_cast<const Byte*>(&data_);
+
+      _stz_impl_REGROWTH(_buffer.insert(_buffer.end(), data_ptr, data_ptr + sizeof(T) * N_));
+    }
+
+    template<typename T, typename = _no_sequence<T>, typename = _if_bytewise<T>>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(T& data_, const size_t N_ = 1)
+    {
+      _stz_impl_IDEBUGGING((N_ > 1) ? "%s x%zu" : "%s", _underlying_name<T>(), N_);
+
+      _stz_impl_SAFE(
+      if _stz_impl_ABNORMAL(_input.left() == 0)
+      {
+        return;
+      }
+
+      if _stz_impl_ABNORMAL(_input.left() < (sizeof(T) * N_))
+      {
+        return;
+      })
+
+      // set data's bytes one by one from the front of the buffer
+      const auto data_ptr   = reinterpret_cast<Byte*>(&data_);
+      const auto buffer_ptr = _input.front;
+      std::memcpy(data_ptr, buffer_ptr, sizeof(T) * N_);
+
+      _input.front += sizeof(T) * N_;
+    }
+    
+    template<typename T>
+    auto _srz_impl(const T& aggregates, size_t N = 1) noexcept -> _if_reflected<T>;
+
+    template<typename T>
+    auto _drz_impl(T& aggregates, size_t N = 1) noexcept -> _if_reflected<T>;
+
+    template<typename T, typename = _if_enum_range<T>>
+    void _srz_impl(const T& enumerations_, const size_t N_ = 1) noexcept
+    {
+      _stz_impl_IDEBUGGING((N_ > 1) ? "%s x%zu" : "%s", _underlying_name<T>(), N_);
+
+      const size_t front = _buffer.size();
+      _stz_impl_REGROWTH(_buffer.resize(front + _enum_span<T>::bytes * N_));
+
+      Byte* raw_ptr = _buffer.data() + front;
+      for (size_t k = 0; k < N_; ++k)
+      {
+        _srz_raw(raw_ptr, (&enumerations_)[k]);
+      }
+    }
+
+    template<typename T, typename = _if_enum_range<T>>
+    void _drz_impl(T& enumerations_, const size_t N_ = 1) noexcept
+    {
+      _stz_impl_IDEBUGGING((N_ > 1) ? "%s x%zu" : "%s", _underlying_name<T>(), N_);
+
+      _stz_impl_SAFE(
+      if _stz_impl_ABNORMAL((_input.left() / _enum_span<T>::bytes) < N_)
+      {
+        return;
+      })
+
+      const Byte* raw_ptr = _input.front;
+      for (size_t k = 0; k < N_; ++k)
+      {
+        _drz_raw(raw_ptr, (&enumerations_)[k]);
+      }
+
+      _input.front += _enum_span<T>::bytes * N_;
+    }
+
+    template<typename base, typename ptr>
+    constexpr
+    void _srz_impl(const Inheritence<base, ptr>&& inheritence_) noexcept
+    {
+      _backdoor::_srz_impl_on_base(std::move(inheritence_));
+    }
+
+    template<typename base, typename ptr>
+    constexpr
+    void _drz_impl(Inheritence<base, ptr>&& inheritence_) noexcept
+    {
+      _backdoor::_drz_impl_on_base(std::move(inheritence_));
+    }
+    
+    template<unsigned size, typename type>
+    constexpr
+    void _srz_impl(const Bitfield<size, type>&& bitfield_) noexcept
+    {
+      _srz_impl(bitfield_.proxy);
+    }
+
+    template<unsigned size, typename type>
+    constexpr
+    void _drz_impl(Bitfield<size, type>&& bitfield_) noexcept
+    {
+      _drz_impl(bitfield_.proxy);
+    }
+
+    template<typename T, size_t N1>
+    void _srz_array(const T (&data_)[N1], std::true_type)
+    {
+      _srz_impl(*static_cast<const T*>(data_), N1);
+    }
+
+    template<typename T, size_t N1>
+    void _drz_array(T (&data_)[N1], std::true_type)
+    {
+      _drz_impl(*static_cast<T*>(data_), N1);
+    }
+
+    // defined once the overloads of every element type are declared
+    template<typename T, size_t N1>
+    void _srz_array(const T (&data)[N1], std::false_type);
+
+    template<typename T, size_t N1>
+    void _drz_array(T (&data)[N1], std::false_type);
+
+    // arrays of raw leaves are copied in one go, strings, containers and pointers element by element
+    template<typename T, size_t N1>
+    void _srz_impl(const T (&data_)[N1])
+    {
+      _srz_array(data_, _is_raw_leaf<T>());
+    }
+
+    template<typename T, size_t N1>
+    void _drz_impl(T (&data_)[N1])
+    {
+      _drz_array(data_, _is_raw_leaf<T>());
+    }
+
+    _stz_impl_MAYBE_UNUSED
+    static
+    void _size_t_srz_impl(const size_t size_)
+    {
+#   if defined(STZ_FIXED_SERIALIZATION)
+      _srz_impl(size_);
+#   else
+      _stz_impl_IDEBUGGING("size_t");
+
+      uint8_t bytes_used = 1;
+      for (size_t bytes = size_; bytes >>= 8; ++bytes_used) {}
+
+      _stz_impl_REGROWTH(_buffer.push_back(static_cast<Byte>(bytes_used)));
+
+      for (size_t bytes = size_; bytes_used; bytes >>= 8, --bytes_used)
+      {
+        _stz_impl_REGROWTH(_buffer.push_back(static_cast<Byte>(bytes & 0xFF)));
+      }
+#   endif
+    }
+
+    _stz_impl_MAYBE_UNUSED
+    static
+    void _size_t_drz_impl(size_t& size_)
+    {
+#   if defined(STZ_FIXED_SERIALIZATION)
+      _drz_impl(size_);
+#   else
+      _stz_impl_IDEBUGGING("size_t");
+
+      _stz_impl_SAFE(
+      if _stz_impl_ABNORMAL(_input.left() == 0)
+      {
+        return;
+      })
+
+      uint8_t bytes_used = *_input.front++;
+
+      _stz_impl_SAFE(
+      if _stz_impl_ABNORMAL(_input.left() < bytes_used)
+      {
+        return;
+      })
+
+      size_ = {};
+      for (size_t k = 0; bytes_used; k += 8, --bytes_used)
+      {
+        size_ |= (*_input.front++ << k);
+      }
+#   endif
+    }
+
+    template<typename T>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::complex<T>& complex) noexcept;
+
+    template<typename T>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::complex<T>& complex) noexcept;
+
+    template<typename T>
+    constexpr
+    void _srz_impl(const std::atomic<T>& atomic) noexcept;
+
+    template<typename T>
+    constexpr
+    void _drz_impl(std::atomic<T>& atomic) noexcept;
+
+# if __cplusplus >= 201703L
+    template<typename T>
+    void _srz_impl(const std::optional<T>& optional) noexcept;
+
+    template<typename T>
+    void _drz_impl(std::optional<T>& optional) noexcept;
+
+    template<typename... T>
+    void _srz_impl(const std::variant<T...>& variant) noexcept;
+
+    template<typename... T>
+    void _drz_impl(std::variant<T...>& variant) noexcept;
+
+    constexpr
+    void _srz_impl(const std::monostate&) noexcept;
+
+    constexpr
+    void _drz_impl(std::monostate&) noexcept;
+
+    template<typename T, typename Tr>
+    void _srz_impl(const std::basic_string_view<T, Tr>& string_view) noexcept;
+
+    // a view cannot own the deserialized characters
+    template<typename T, typename Tr>
+    void _drz_impl(std::basic_string_view<T, Tr>& string_view) noexcept = delete;
+# endif
+
+    template<typename T, typename Tr, typename A>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::basic_string<T, Tr, A>& string) noexcept;
+
+    template<typename T, typename Tr, typename A>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::basic_string<T, Tr, A>& string) noexcept;
+
+    template<typename T, size_t N1>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::array<T, N1>& array) noexcept;
+
+    template<typename T, size_t N1>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::array<T, N1>& array) noexcept;
+
+    template<typename T, typename A>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::vector<T, A>& vector) noexcept;
+
+    template<typename T, typename A>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::vector<T, A>& vector) noexcept;
+
+    template<typename A>
+    void _srz_impl(const std::vector<bool, A>& vector) noexcept;
+
+    template<typename A>
+    void _drz_impl(std::vector<bool, A>& vector) noexcept;
+
+    template<typename T>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::valarray<T>& valarray) noexcept;
+
+    template<typename T>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::valarray<T>& valarray) noexcept;
+
+    template<size_t N1>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::bitset<N1>& bitset) noexcept;
+
+    template<size_t N1>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::bitset<N1>& bitset) noexcept;
+
+    template<typename T, typename A>
+    constexpr
+    void _srz_impl(const std::list<T, A>& list) noexcept;
+
+    template<typename T, typename A>
+    constexpr
+    void _drz_impl(std::list<T, A>& list) noexcept;
+
+    template<typename T, typename C>
+    constexpr
+    void _srz_impl(const std::stack<T, C>& stack) noexcept;
+
+    template<typename T, typename C>
+    constexpr
+    void _drz_impl(std::stack<T, C>& stack) noexcept;
+
+    template<typename T, typename A>
+    constexpr
+    void _srz_impl(const std::forward_list<T, A>& forward_list) noexcept;
+
+    template<typename T, typename A>
+    constexpr
+    void _drz_impl(std::forward_list<T, A>& forward_list) noexcept;
+
+    template<typename T, typename S>
+    constexpr
+    void _srz_impl(const std::queue<T, S>& queue) noexcept;
+
+    template<typename T, typename S>
+    constexpr
+    void _drz_impl(std::queue<T, S>& queue) noexcept;
+
+    template<typename T, class C, class F>
+    constexpr
+    void _srz_impl(const std::priority_queue<T, C, F>& priority_queue) noexcept;
+
+    template<typename T, class C, class F>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::priority_queue<T, C, F>& priority_queue) noexcept;
+
+    template<typename T, typename A>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::deque<T, A>& deque) noexcept;
+
+    template<typename T, typename A>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::deque<T, A>& deque) noexcept;
+
+    template<typename T1, typename T2>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::pair<T1, T2>& pair) noexcept;
+
+    template<typename T1, typename T2>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::pair<T1, T2>& pair) noexcept;
+
+    template<typename T1, typename T2, class H, class E, class A>
+    constexpr
+    void _srz_impl(const std::unordered_map<T1, T2, H, E, A>& unordered_map) noexcept;
+
+    template<typename T1, typename T2, class H, class E, class A>
+    constexpr
+    void _drz_impl(std::unordered_map<T1, T2, H, E, A>& unordered_map) noexcept;
+
+    template<typename T1, typename T2, class H, class E, class A>
+    constexpr
+    void _srz_impl(const std::unordered_multimap<T1, T2, H, E, A>& unordered_multimap) noexcept;
+
+    template<typename T1, typename T2, class H, class E, class A>
+    constexpr
+    void _drz_impl(std::unordered_multimap<T1, T2, H, E, A>& unordered_multimap) noexcept;
+
+    template<typename T1, typename T2, class C, class A>
+    constexpr
+    void _srz_impl(const std::map<T1, T2, C, A>& map) noexcept;
+
+    template<typename T1, typename T2, class C, class A>
+    constexpr
+    void _drz_impl(std::map<T1, T2, C, A>& map) noexcept;
+
+    template<typename T1, typename T2, class C, class A>
+    constexpr
+    void _srz_impl(const std::multimap<T1, T2, C, A>& multimap) noexcept;
+
+    template<typename T1, typename T2, class C, class A>
+    constexpr
+    void _drz_impl(std::multimap<T1, T2, C, A>& multimap) noexcept;
+
+    template<typename T, class H, class E, class A>
+    constexpr
+    void _srz_impl(const std::unordered_set<T, H, E, A>& unordered_set) noexcept;
+
+    template<typename T, class H, class E, class A>
+    constexpr
+    void _drz_impl(std::unordered_set<T, H, E, A>& unordered_set) noexcept;
+
+    template<typename T, class H, class E, class A>
+    constexpr
+    void _srz_impl(const std::unordered_multiset<T, H, E, A>& unordered_multiset) noexcept;
+
+    template<typename T, class H, class E, class A>
+    constexpr
+    void _drz_impl(std::unordered_multiset<T, H, E, A>& unordered_multiset) noexcept;
+
+    template<typename T, class C, class A>
+    constexpr
+    void _srz_impl(const std::set<T, C, A>& set) noexcept;
+
+    template<typename T, class C, class A>
+    constexpr
+    void _drz_impl(std::set<T, C, A>& set) noexcept;
+
+    template<typename T, class C, class A>
+    constexpr
+    void _srz_impl(const std::multiset<T, C, A>& multiset) noexcept;
+
+    template<typename T, class C, class A>
+    constexpr
+    void _drz_impl(std::multiset<T, C, A>& multiset) noexcept;
+
+    template<typename... T>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::tuple<T...>& tuple) noexcept;
+
+    template<typename... T>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::tuple<T...>& tuple) noexcept;
+
+    template<typename T>
+    void _srz_impl(T* const& pointer) noexcept;
+
+    template<typename T>
+    void _drz_impl(T*& pointer) noexcept;
+
+    template<typename T>
+    void _srz_impl(const std::unique_ptr<T>& unique_ptr) noexcept;
+
+    template<typename T>
+    void _drz_impl(std::unique_ptr<T>& unique_ptr) noexcept;
+
+    template<typename T>
+    void _srz_impl(const std::shared_ptr<T>& shared_ptr) noexcept;
+
+    template<typename T>
+    void _drz_impl(std::shared_ptr<T>& shared_ptr) noexcept;
+
+    template<typename T>
+    void _srz_impl(const RunLength<T>& run_length) noexcept;
+
+    template<typename T>
+    void _drz_impl(RunLength<T>& run_length) noexcept;
+
+    template<typename T>
+    void _srz_impl(const RunLength<T>&& run_length) noexcept;
+
+    template<typename T>
+    void _drz_impl(RunLength<T>&& run_length) noexcept;
+
+    template<typename T>
+    void _srz_impl(const NodeReuse<T>& node_reuse) noexcept;
+
+    template<typename T>
+    void _drz_impl(NodeReuse<T>& node_reuse) noexcept;
+
+    template<typename T>
+    void _srz_impl(const NodeReuse<T>&& node_reuse) noexcept;
+
+    template<typename T>
+    void _drz_impl(NodeReuse<T>&& node_reuse) noexcept;
+
+    template<typename T>
+    void _srz_impl(const Chunked<T>& chunked) noexcept;
+
+    template<typename T>
+    void _drz_impl(Chunked<T>& chunked) noexcept;
+
+    template<typename T>
+    void _srz_impl(const Chunked<T>&& chunked) noexcept;
+
+    template<typename T>
+    void _drz_impl(Chunked<T>&& chunked) noexcept;
+
+    template<typename T, size_t N1>
+    void _srz_array(const T (&data_)[N1], std::false_type)
+    {
+      for (const auto& element : data_)
+      {
+        _srz_impl(element);
+      }
+    }
+
+    template<typename T, size_t N1>
+    void _drz_array(T (&data_)[N1], std::false_type)
+    {
+      for (auto& element : data_)
+      {
+        _drz_impl(element);
+      }
+    }
+
+    template<typename T>
+    using _if_fundamental = typename std::enable_if<std::is_fundamental<T>::value == true>::type;
+
+    template<typename T>
+    using _no_fundamental = typename std::enable_if<std::is_fundamental<T>::value != true>::type;
+
+    template<typename T, typename = _if_fundamental<T>>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl_many_fundamentals(const T& things_, const size_t count_) noexcept
+    {
+      _srz_impl(things_, count_);
+    }
+
+    template<typename T, typename = _no_fundamental<T>>
+    constexpr
+    void _srz_impl_many_fundamentals(const T&, const size_t, ...) noexcept
+    {}
+
+    template<typename T, typename = _if_fundamental<T>>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl_many_fundamentals(T& things_, const size_t count_) noexcept
+    {
+      _drz_impl(things_, count_);
+    }
+
+    template<typename T, typename = _no_fundamental<T>>
+    constexpr
+    void _drz_impl_many_fundamentals(T&, const size_t, ...) noexcept
+    {}
+
+    // std::vector has no standard way to grow without value-initializing, so only the elements it already holds are
+    // copied over in one go, the others are appended into reserved storage; every element is written once
+    template<typename T, typename A, typename = _if_fundamental<T>>
+    void _drz_assign_fundamentals(std::vector<T, A>& vector_, const size_t size_) noexcept
+    {
+      _stz_impl_SAFE(
+      if _stz_impl_ABNORMAL((_input.left() / sizeof(T)) < size_)
+      {
+        return;
+      })
+
+      const size_t kept = (vector_.size() < size_) ? vector_.size() : size_;
+
+      vector_.resize(kept);
+
+      if (kept != 0)
+      {
+        std::memcpy(vector_.data(), _input.front, sizeof(T) * kept);
+      }
+
+      const Byte* raw_ptr = _input.front + sizeof(T) * kept;
+      _input.front       += sizeof(T) * size_;
+
+      if (kept != size_)
+      {
+        vector_.reserve(size_);
+
+        for (; raw_ptr != _input.front; raw_ptr += sizeof(T))
+        {
+          T element;
+          std::memcpy(&element, raw_ptr, sizeof(T));
+          vector_.push_back(element);
+        }
+      }
+    }
+
+    template<typename T, typename A, typename = _no_fundamental<T>>
+    void _drz_assign_fundamentals(std::vector<T, A>&, const size_t, ...) noexcept
+    {}
+
+    // same for 'string_', basic_string::assign(first, last) would go through a temporary string
+    template<typename T, typename Tr, typename A, typename = _if_fundamental<T>>
+    void _drz_assign_characters(std::basic_string<T, Tr, A>& string_, const size_t size_) noexcept
+    {
+      _stz_impl_SAFE(
+      if _stz_impl_ABNORMAL((_input.left() / sizeof(T)) < size_)
+      {
+        return;
+      })
+
+      const Byte* const raw_ptr = _input.front;
+
+#   if defined(__cpp_lib_string_resize_and_overwrite)
+      string_.resize_and_overwrite(size_, [raw_ptr](T* const data_, const size_t count_) noexcept
+      {
+        std::memcpy(data_, raw_ptr, sizeof(T) * count_);
+        return count_;
+      });
+#   else
+      if (sizeof(T) == 1)
+      {
+        string_.assign(reinterpret_cast<const T*>(raw_ptr), size_);
+      }
+      else
+      {
+        string_.resize(size_);
+        std::memcpy(&string_[0], raw_ptr, sizeof(T) * size_);
+      }
+#   endif
+
+      _input.front += sizeof(T) * size_;
+    }
+
+    template<typename T, typename Tr, typename A, typename = _no_fundamental<T>>
+    void _drz_assign_characters(std::basic_string<T, Tr, A>&, const size_t, ...) noexcept
+    {}
+
+    // valarray has no way to grow without value-initializing either, but can be built as a copy of an array: input
+    // aligned for 'T' is copied from in place, otherwise the valarray is resized first; same size is written once
+    template<typename T, typename = _if_fundamental<T>>
+    void _drz_valarray_fundamentals(std::valarray<T>& valarray_, const size_t size_) noexcept
+    {
+      _stz_impl_SAFE(
+      if _stz_impl_ABNORMAL((_input.left() / sizeof(T)) < size_)
+      {
+        return;
+      })
+
+      if (valarray_.size() != size_)
+      {
+        if (reinterpret_cast<uintptr_t>(_input.front) % alignof(T) == 0)
+        {
+          valarray_ = std::valarray<T>(reinterpret_cast<const T*>(_input.front), size_);
+
+          _input.front += sizeof(T) * size_;
+          return;
+        }
+
+        valarray_.resize(size_);
+      }
+
+      if (size_ != 0)
+      {
+        std::memcpy(&valarray_[0], _input.front, sizeof(T) * size_);
+      }
+
+      _input.front += sizeof(T) * size_;
+    }
+
+    template<typename T, typename = _no_fundamental<T>>
+    void _drz_valarray_fundamentals(std::valarray<T>&, const size_t, ...) noexcept
+    {}
+
+    template<typename base, typename ptr>
+    void _backdoor::_srz_impl_on_base(const Inheritence<base, ptr>&& inheritence_)
+    {
+      _srz_impl(*static_cast<const base*>(inheritence_.base_ptr));
+    }
+
+    template<typename base, typename ptr>
+    void _backdoor::_drz_impl_on_base(Inheritence<base, ptr>&& inheritence_)
+    {
+      _drz_impl(*static_cast<base*>(inheritence_.base_ptr));
+    }
+
+    template<typename T, typename... T_>
+    constexpr
+    auto _sizeof_many() noexcept -> typename std::enable_if<sizeof...(T_) == 0, size_t>::type
+    {
+      return sizeof(T);
+    }
+
+    template<typename T, typename... T_>
+    constexpr
+    auto _sizeof_many() noexcept -> typename std::enable_if<sizeof...(T_) != 0, size_t>::type
+    {
+      return sizeof(T) + _sizeof_many<T_...>();
+    }
+
+    template<typename T>
+    using _strip = typename std::remove_reference<T>::type;
+
+    // Helper to check if a single type is non-const
+    template<typename T>
+    struct _is_mutable : std::integral_constant<bool, not std::is_const<_strip<T>>::value>
+    {};
+
+    // Recursive template to check if all types are non-const
+    template<typename... T_>
+    struct _all_mutable;
+
+    template<typename T, typename... T_>
+    struct _all_mutable<T, T_...> : std::integral_constant<bool, _is_mutable<T>::value && _all_mutable<T_...>::value>
+    {};
+
+    template<>
+    struct _all_mutable<> : std::true_type
+    {};
+
+    // _if_mutable type alias
+    template<typename... T_>
+    using _if_mutable = typename std::enable_if<_all_mutable<T_...>::value>::type;
+
+    constexpr int _srz_dispatch() noexcept { return 0; }
+
+    template<typename T, typename... T_>
+    constexpr
+    void _srz_dispatch(T&& thing_, T_&&... things_) noexcept
+    {
+      _srz_impl(std::forward<const T>(thing_));
+      _srz_dispatch(std::forward<const T_>(things_)...);
+    }
+
+    constexpr int _drz_dispatch() noexcept { return 0; }
+
+    template<typename T, typename... T_, typename = _if_mutable<T, T_...>>
+    constexpr
+    void _drz_dispatch(T&& thing_, T_&&... things_) noexcept
+    {
+      _drz_impl(std::forward<T>(thing_));
+      _drz_dispatch(std::forward<T_>(things_)...);
+    }
+
+    struct _srz
+    {
+      struct _ver
+      {
+        template<typename type>
+        void operator=(const type version_) noexcept
+        {
+          if (_set(version_))
+          {
+            _size_t_srz_impl(_version);
+          }
+        }
+
+        _stz_impl_UNSAFE(constexpr)
+        bool operator<(size_t) const noexcept
+        {
+          _stz_impl_SAFE(
+          if (_version == static_cast<size_t>(-1))
+          {
+            _stz_impl_WARNING("'serializer.version' was not set properly before usage.");
+          })
+
+          return false;
+        }
+
+        _stz_impl_UNSAFE(constexpr)
+        bool operator<=(size_t) const noexcept
+        {
+          _stz_impl_SAFE(
+          if (_version == static_cast<size_t>(-1))
+          {
+            _stz_impl_WARNING("'serializer.version' was not set properly before usage.");
+          })
+
+          return false;
+        }
+
+        _stz_impl_UNSAFE(constexpr)
+        bool operator>(size_t) const noexcept
+        {
+          _stz_impl_SAFE(
+          if (_version == static_cast<size_t>(-1))
+          {
+            _stz_impl_WARNING("'serializer.version' was not set properly before usage.");
+          })
+
+          return true;
+        }
+
+        _stz_impl_UNSAFE(constexpr)
+        bool operator>=(size_t) const noexcept
+        {
+          _stz_impl_SAFE(
+          if (_version == static_cast<size_t>(-1))
+          {
+            _stz_impl_WARNING("'serializer.version' was not set properly before usage.");
+            std::exit(-1);
+          })
+
+          return true;
+        }
+
+      protected:
+        // whether 'version_' is valid and has to be written
+        template<typename type>
+        bool _set(const type version_) noexcept
+        {
+          _version = static_cast<size_t>(version_);
+
+          _stz_impl_SAFE(
+          if (version_ < static_cast<type>(0))
+          {
+            _stz_impl_WARNING("invalid 'serializer.version' value (%zu).", _version);
+            _version = static_cast<type>(-1);
+            return false;
+          })
+
+          return true;
+        }
+
+        size_t _version = static_cast<size_t>(-1);
+      };
+
+      void operator<=(_ver) const = delete;
+      void operator, (_ver) const = delete;
+
+      _ver version;
+
+      template<typename type>
+      constexpr
+      _srz operator<=(const type& thing_) const &
+      {
+        return _srz_impl(thing_), _srz();
+      }
+
+      template<typename type>
+      constexpr
+      _srz operator,(const type& thing_) const &&
+      {
+        return _srz_impl(thing_), _srz();
+      }
+
+      template<class base, typename ptr>
+      constexpr
+      _srz operator<=(const Inheritence<base, ptr>&& thing_) const &
+      {
+        return _srz_impl(std::move(thing_)), _srz();
+      }
+
+      template<class base, typename ptr>
+      constexpr
+      _srz operator,(const Inheritence<base, ptr>&& thing_) const &&
+      {
+        return _srz_impl(std::move(thing_)), _srz();
+      }
+
+      template<typename type>
+      void operator,(const type) const & = delete;
+    };
+
+    struct _drz
+    {
+      struct _ver
+      {
+        template<typename type>
+        void operator=(type _stz_impl_SAFE(version_))
+        {
+          _stz_impl_SAFE(
+          if (version_ >= static_cast<type>(0))
+        ) {
+            _size_t_drz_impl(_version);
+          }
+        }
+
+        constexpr bool operator< (const size_t version_) const noexcept { return _version <  version_; }
+        constexpr bool operator<=(const size_t version_) const noexcept { return _version <= version_; }
+        constexpr bool operator> (const size_t version_) const noexcept { return _version >  version_; }
+        constexpr bool operator>=(const size_t version_) const noexcept { return _version >= version_; }
+
+      private:
+        size_t _version = static_cast<size_t>(-1);
+      };
+
+      void operator<=(_ver) const = delete;
+      void operator, (_ver) const = delete;
+
+      _ver version;
+
+      template<typename type>
+      constexpr
+      _drz operator<=(type& thing_) const &
+      {
+        return _drz_impl(thing_), _drz();
+      }
+
+      template<typename type>
+      constexpr
+      _drz operator,(type& thing_) const &&
+      {
+        return _drz_impl(thing_), _drz();
+      }
+
+      template<typename type>
+      void operator<=(const type&) const & = delete;
+
+      template<typename type>
+      void operator,(const type&) const && = delete;
+
+      template<class base, typename ptr>
+      constexpr
+      _drz operator<=(Inheritence<base, ptr>&& thing_) const &
+      {
+        return _drz_impl(std::move(thing_)), _drz();
+      }
+
+      template<class base, typename ptr>
+      constexpr
+      _drz operator,(Inheritence<base, ptr>&& thing_) const &&
+      {
+        return _drz_impl(std::move(thing_)), _drz();
+      }
+
+      template<typename type>
+      constexpr
+      _drz operator<=(RunLength<type>&& thing_) const &
+      {
+        return _drz_impl(std::move(thing_)), _drz();
+      }
+
+      template<typename type>
+      constexpr
+      _drz operator,(RunLength<type>&& thing_) const &&
+      {
+        return _drz_impl(std::move(thing_)), _drz();
+      }
+
+      template<typename type>
+      constexpr
+      _drz operator<=(NodeReuse<type>&& thing_) const &
+      {
+        return _drz_impl(std::move(thing_)), _drz();
+      }
+
+      template<typename type>
+      constexpr
+      _drz operator,(NodeReuse<type>&& thing_) const &&
+      {
+        return _drz_impl(std::move(thing_)), _drz();
+      }
+
+      template<typename type>
+      constexpr
+      _drz operator<=(Chunked<type>&& thing_) const &
+      {
+        return _drz_impl(std::move(thing_)), _drz();
+      }
+
+      template<typename type>
+      constexpr
+      _drz operator,(Chunked<type>&& thing_) const &&
+      {
+        return _drz_impl(std::move(thing_)), _drz();
+      }
+
+      template<typename type>
+      void operator,(type) const & = delete;
+    };
+
+    template<typename T>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::complex<T>& complex_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::complex<%s>", _underlying_name<T>());
+
+      _srz_static(complex_);
+    }
+
+    template<typename T>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::complex<T>& complex_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::complex<%s>", _underlying_name<T>());
+
+      _drz_static(complex_);
+    }
+
+    template<typename T>
+    constexpr
+    void _srz_impl(const std::atomic<T>& atomic_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::atomic<%s>", _underlying_name<T>());
+
+      _srz_impl(static_cast<const T&>(atomic_));
+    }
+
+    template<typename T>
+    constexpr
+    void _drz_impl(std::atomic<T>& atomic_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::atomic<%s>", _underlying_name<T>());
+
+      T value = {};
+      _drz_impl(value);
+      atomic_ = value;
+    }
+
+    template<typename T, typename Tr, typename A>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::basic_string<T, Tr, A>& string_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::basic_string<%s>", _underlying_name<T>());
+
+      _size_t_srz_impl(string_.size());
+
+      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
+      {
+        _srz_impl_many_fundamentals(string_[0], string_.size());
+      }
+      else
+      {
+        for (const auto character : string_)
+        {
+          _srz_impl(character);
+        }
+      }
+    }
+
+    template<typename T, typename Tr, typename A>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::basic_string<T, Tr, A>& string_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::basic_string<%s>", _underlying_name<T>());
+      _stz_impl_STATS(const _capacity_probe<std::basic_string<T, Tr, A>> probe(string_));
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
+      {
+        _drz_assign_characters(string_, size);
+      }
+      else
+      {
+        string_.resize(size);
+
+        for (auto& character : string_)
+        {
+          _drz_impl(character);
+        }
+      }
+    }
+
+    template<typename T, size_t N1>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::array<T, N1>& array_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::array<%s, %zu>", _underlying_name<T>(), N1);
+
+      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
+      {
+        _srz_impl_many_fundamentals(array_[0], N1);
+      }
+      else if _stz_impl_CONSTEXPR_CPP17 (_static_size<std::array<T, N1>>::value != 0)
+      {
+        _srz_static(array_);
+      }
+      else
+      {
+        for (const auto& value : array_)
+        {
+          _srz_impl(value);
+        }
+      }
+    }
+
+    template<typename T, size_t N1>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::array<T, N1>& array_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::array<%s, %zu>", _underlying_name<T>(), N1);
+
+      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
+      {
+        _drz_impl_many_fundamentals(array_[0], N1);
+      }
+      else if _stz_impl_CONSTEXPR_CPP17 (_static_size<std::array<T, N1>>::value != 0)
+      {
+        _drz_static(array_);
+      }
+      else
+      {
+        for (auto& value : array_)
+        {
+          _drz_impl(value);
+        }
+      }
+    }
+
+    // offsets from the minimum of the range on as few bits as the range allows, least significant first
+    template<typename T, typename A, typename = _if_enum_range<T>>
+    void _srz_packed_enums(const std::vector<T, A>& vector_) noexcept
+    {
+      constexpr unsigned bits = _enum_span<T>::bits;
+
+      const size_t front = _buffer.size();
+      _stz_impl_REGROWTH(_buffer.resize(front + (vector_.size() * bits + 7) / 8));
+
+      Byte*    raw_ptr = _buffer.data() + front;
+      uint64_t pending = 0;
+      unsigned filled  = 0;
+
+      for (const auto value : vector_)
+      {
+        pending |= static_cast<uint64_t>(_srz_enum_offset(value)) << filled;
+        filled  += bits;
+
+        for (; filled >= 8; filled -= 8, pending >>= 8)
+        {
+          *raw_ptr++ = static_cast<Byte>(pending);
+        }
+      }
+
+      if (filled != 0)
+      {
+        *raw_ptr = static_cast<Byte>(pending);
+      }
+    }
+
+    template<typename T, typename A, typename = _no_enum_range<T>>
+    void _srz_packed_enums(const std::vector<T, A>&, ...) noexcept
+    {}
+
+    template<typename T, typename A, typename = _if_enum_range<T>>
+    void _drz_packed_enums(std::vector<T, A>& vector_) noexcept
+    {
+      constexpr unsigned bits = _enum_span<T>::bits;
+      constexpr uint64_t mask = (uint64_t(1) << bits) - 1;
+
+      _stz_impl_SAFE(
+      if _stz_impl_ABNORMAL((_input.left() * 8 / bits) < vector_.size())
+      {
+        return;
+      })
+
+      const Byte* raw_ptr = _input.front;
+      uint64_t    pending = 0;
+      unsigned    filled  = 0;
+
+      for (auto& value : vector_)
+      {
+        for (; filled < bits; filled += 8)
+        {
+          pending |= static_cast<uint64_t>(*raw_ptr++) << filled;
+        }
+
+        _stz_impl_SAFE(
+        if _stz_impl_EXPECTED((pending & mask) <= _enum_span<T>::value))
+        {
+          value = _enum_value<T>(pending & mask);
+        }
+
+        pending >>= bits;
+        filled   -= bits;
+      }
+
+      _input.front += (vector_.size() * bits + 7) / 8;
+    }
+
+    template<typename T, typename A, typename = _no_enum_range<T>>
+    void _drz_packed_enums(std::vector<T, A>&, ...) noexcept
+    {}
+
+    struct _with_allocator {};
+
+    // resize 'container_' to 'size_' elements, the missing ones built with the container's allocator
+    // when they hold allocator-aware parts
+    template<typename C>
+    void _resize(C& container_, const size_t size_, std::true_type) noexcept
+    {
+      container_.resize(size_);
+    }
+
+    template<typename C>
+    void _resize(C& container_, const size_t size_, _with_allocator) noexcept
+    {
+      if (size_ <= container_.size())
+      {
+        container_.resize(size_);
+        return;
+      }
+
+      container_.reserve(size_);
+      for (size_t k = container_.size(); k < size_; ++k)
+      {
+        container_.emplace_back(_make_element(container_));
+      }
+    }
+
+    template<typename C>
+    void _resize(C& container_, const size_t size_) noexcept
+    {
+      _resize(container_, size_, typename std::conditional<_holds_allocator<C>::value, _with_allocator, std::true_type>::type());
+    }
+
+    template<typename T, typename A>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::vector<T, A>& vector_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::vector<%s>", _underlying_name<T>());
+
+      _size_t_srz_impl(vector_.size());
+
+      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
+      {
+        _srz_impl_many_fundamentals(vector_[0], vector_.size());
+      }
+      else if _stz_impl_CONSTEXPR_CPP17 (_enum_span<T>::bits != 0)
+      {
+        _srz_packed_enums(vector_);
+      }
+      else if _stz_impl_CONSTEXPR_CPP17 (_static_size<T>::value != 0)
+      {
+        const size_t front = _buffer.size();
+        _stz_impl_REGROWTH(_buffer.resize(front + _static_size<T>::value * vector_.size()));
+
+        Byte* raw_ptr = _buffer.data() + front;
+        for (const auto& value : vector_)
+        {
+          _srz_raw(raw_ptr, value);
+        }
+      }
+      else
+      {
+        for (const auto& value : vector_)
+        {
+          _srz_impl(value);
+        }
+      }
+    }
+
+    template<typename T, typename A>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::vector<T, A>& vector_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::vector<%s>", _underlying_name<T>());
+      _stz_impl_STATS(const _capacity_probe<std::vector<T, A>> probe(vector_));
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
+      {
+        _drz_assign_fundamentals(vector_, size);
+        return;
+      }
+
+      _resize(vector_, size);
+
+      if _stz_impl_CONSTEXPR_CPP17 (_enum_span<T>::bits != 0)
+      {
+        _drz_packed_enums(vector_);
+      }
+      else if _stz_impl_CONSTEXPR_CPP17 (_static_size<T>::value != 0)
+      {
+        _stz_impl_SAFE(
+        if _stz_impl_ABNORMAL((_input.left() / _static_size<T>::value) < size)
+        {
+          return;
+        })
+
+        const Byte* raw_ptr = _input.front;
+        for (auto& value : vector_)
+        {
+          _drz_raw(raw_ptr, value);
+        }
+
+        _input.front += _static_size<T>::value * size;
+      }
+      else
+      {
+        for (auto& value : vector_)
+        {
+          _drz_impl(value);
+        }
+      }
+    }
+
+    template<typename A>
+    void _srz_impl(const std::vector<bool, A>& vector_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::vector<bool>");
+
+      _size_t_srz_impl(vector_.size());
+
+      for (const bool value : vector_)
+      {
+        _srz_impl(value);
+      }
+    }
+
+    template<typename A>
+    void _drz_impl(std::vector<bool, A>& vector_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::vector<bool>");
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      vector_.clear();
+      vector_.reserve(size);
+
+      bool value = {};
+      for (size_t k = 0; k < size; ++k)
+      {
+        _drz_impl(value);
+        vector_.push_back(value);
+      }
+    }
+
+    template<typename T>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::valarray<T>& valarray_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::valarray<%s>", _underlying_name<T>());
+
+      _size_t_srz_impl(valarray_.size());
+
+      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
+      {
+        _srz_impl_many_fundamentals(valarray_[0], valarray_.size());
+      }
+      else
+      {
+        for (const auto& value : valarray_)
+        {
+          _srz_impl(value);
+        }
+      }
+    }
+
+    template<typename T>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::valarray<T>& valarray_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::valarray<%s>", _underlying_name<T>());
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
+      {
+        _drz_valarray_fundamentals(valarray_, size);
+      }
+      else
+      {
+        if (valarray_.size() != size)
+        {
+          valarray_.resize(size);
+        }
+
+        for (auto& value : valarray_)
+        {
+          _drz_impl(value);
+        }
+      }
+    }
+
+    template<size_t N1>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::bitset<N1>& bitset_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::bitset<%zu>", N1);
+
+      _srz_impl(bitset_, 1);
+    }
+
+    template<size_t N1>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::bitset<N1>& bitset_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::bitset<%zu>", N1);
+
+      _drz_impl(bitset_, 1);
+    }
+
+    // emplace an element to deserialize into, constructed with Deserializing when not default-constructible, or built
+    // with the container's allocator when it holds allocator-aware parts
+    template<typename C>
+    using _emplace_tag = typename std::conditional<
+      _holds_allocator<C>::value, _with_allocator, std::is_default_constructible<typename C::value_type>
+    >::type;
+
+    template<typename C>
+    auto _emplace_back(C& container_, std::true_type) -> typename C::reference
+    {
+      container_.emplace_back();
+      return container_.back();
+    }
+
+    template<typename C>
+    auto _emplace_back(C& container_, std::false_type) -> typename C::reference
+    {
+      container_.emplace_back(Deserializing());
+      return container_.back();
+    }
+
+    template<typename C>
+    auto _emplace_back(C& container_, _with_allocator) -> typename C::reference
+    {
+      container_.emplace_back(_make_element(container_));
+      return container_.back();
+    }
+
+    template<typename C>
+    auto _emplace_back(C& container_) -> typename C::reference
+    {
+      return _emplace_back(container_, _emplace_tag<C>());
+    }
+
+    template<typename C>
+    auto _emplace_after(C& container_, const typename C::const_iterator position_, std::true_type) -> typename C::iterator
+    {
+      return container_.emplace_after(position_);
+    }
+
+    template<typename C>
+    auto _emplace_after(C& container_, const typename C::const_iterator position_, std::false_type) -> typename C::iterator
+    {
+      return container_.emplace_after(position_, Deserializing());
+    }
+
+    template<typename C>
+    auto _emplace_after(C& container_, const typename C::const_iterator position_, _with_allocator) -> typename C::iterator
+    {
+      return container_.emplace_after(position_, _make_element(container_));
+    }
+
+    template<typename C>
+    auto _emplace_after(C& container_, const typename C::const_iterator position_) -> typename C::iterator
+    {
+      return _emplace_after(container_, position_, _emplace_tag<C>());
+    }
+
+    // the underlying container and comparator of the adaptors are protected, a derived type can name them
+    template<class A>
+    struct _adaptor_access : A
+    {
+      static
+      auto _container(const A& adaptor_) noexcept -> const typename A::container_type&
+      {
+        return adaptor_.*(&_adaptor_access::c);
+      }
+
+      static
+      auto _container(A& adaptor_) noexcept -> typename A::container_type&
+      {
+        return adaptor_.*(&_adaptor_access::c);
+      }
+
+      template<class F>
+      static
+      auto _compare(A& adaptor_) noexcept -> F&
+      {
+        return adaptor_.*(&_adaptor_access::comp);
+      }
+    };
+
+    template<class A>
+    auto _adaptor_container(const A& adaptor_) noexcept -> const typename A::container_type&
+    {
+      return _adaptor_access<A>::_container(adaptor_);
+    }
+
+    template<class A>
+    auto _adaptor_container(A& adaptor_) noexcept -> typename A::container_type&
+    {
+      return _adaptor_access<A>::_container(adaptor_);
+    }
+
+    template<typename T, typename A>
+    constexpr
+    void _srz_impl(const std::list<T, A>& list_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::list<%s>", _underlying_name<T>());
+
+      _size_t_srz_impl(list_.size());
+
+      for (const auto& value : list_)
+      {
+        _srz_impl(value);
+      }
+    }
+
+    template<typename T, typename A>
+    constexpr
+    void _drz_impl(std::list<T, A>& list_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::list<%s>", _underlying_name<T>());
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      // overwrite the elements already there, then construct the missing ones in place
+      auto iterator = list_.begin();
+      for (const auto end = list_.end(); size && iterator != end; --size, ++iterator)
+      {
+        _drz_impl(*iterator);
+      }
+      list_.erase(iterator, list_.end());
+
+      _stz_impl_STATS(_count_nodes<std::list<T, A>>(size));
+
+      for (; size; --size)
+      {
+        _drz_impl(_emplace_back(list_));
+      }
+    }
+
+    template<typename T, typename C>
+    constexpr
+    void _srz_impl(const std::stack<T, C>& stack_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::stack<%s>", _underlying_name<T>());
+
+      // bottom first, as stored
+      _srz_impl(_adaptor_container(stack_));
+    }
+
+    template<typename T, typename C>
+    constexpr
+    void _drz_impl(std::stack<T, C>& stack_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::stack<%s>", _underlying_name<T>());
+
+      _drz_impl(_adaptor_container(stack_));
+    }
+
+    template<typename T, typename A>
+    constexpr
+    void _srz_impl(const std::forward_list<T, A>& forward_list_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::forward_list<%s>", _underlying_name<T>());
+
+      size_t size = 0;
+      for (auto iterator = forward_list_.begin(), end = forward_list_.end(); iterator != end; ++iterator)
+      {
+        ++size;
+      }
+      _size_t_srz_impl(size);
+
+      for (const auto& value : forward_list_)
+      {
+        _srz_impl(value);
+      }
+    }
+
+    template<typename T, typename A>
+    constexpr
+    void _drz_impl(std::forward_list<T, A>& forward_list_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::forward_list<%s>", _underlying_name<T>());
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      // overwrite the elements already there, then construct the missing ones in place
+      auto before = forward_list_.before_begin();
+      for (auto iterator = forward_list_.begin(), end = forward_list_.end(); size && iterator != end; --size, ++before, ++iterator)
+      {
+        _drz_impl(*iterator);
+      }
+      forward_list_.erase_after(before, forward_list_.end());
+
+      _stz_impl_STATS(_count_nodes<std::forward_list<T, A>>(size));
+
+      for (; size; --size)
+      {
+        before = _emplace_after(forward_list_, before);
+        _drz_impl(*before);
+      }
+    }
+
+    template<typename T, typename S>
+    constexpr
+    void _srz_impl(const std::queue<T, S>& queue_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::queue<%s>", _underlying_name<T>());
+
+      // front first, as stored
+      _srz_impl(_adaptor_container(queue_));
+    }
+
+    template<typename T, typename S>
+    constexpr
+    void _drz_impl(std::queue<T, S>& queue_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::queue<%s>", _underlying_name<T>());
+
+      _drz_impl(_adaptor_container(queue_));
+    }
+
+    template<typename T, class C, class F>
+    constexpr
+    void _srz_impl(const std::priority_queue<T, C, F>& priority_queue_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::priority_queue<%s>", _underlying_name<std::priority_queue<T, C, F>>());
+
+      // in heap order, as stored
+      _srz_impl(_adaptor_container(priority_queue_));
+    }
+
+    template<typename T, class C, class F>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::priority_queue<T, C, F>& priority_queue_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::priority_queue<%s>", _underlying_name<std::priority_queue<T, C, F>>());
+
+      auto& container = _adaptor_container(priority_queue_);
+      _drz_impl(container);
+
+      // already a heap unless the data was altered or the comparator differs, make_heap is O(n) either way
+      std::make_heap(container.begin(), container.end(), _adaptor_access<std::priority_queue<T, C, F>>::template _compare<F>(priority_queue_));
+    }
+
+    template<typename T, typename A>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::deque<T, A>& deque_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::deque<%s>", _underlying_name<T>());
+
+      _size_t_srz_impl(deque_.size());
+
+      if _stz_impl_CONSTEXPR_CPP17 (_static_size<T>::value != 0)
+      {
+        const size_t front = _buffer.size();
+        _stz_impl_REGROWTH(_buffer.resize(front + _static_size<T>::value * deque_.size()));
+
+        Byte* raw_ptr = _buffer.data() + front;
+        for (const auto& value : deque_)
+        {
+          _srz_raw(raw_ptr, value);
+        }
+      }
+      else
+      {
+        for (const auto& value : deque_)
+        {
+          _srz_impl(value);
+        }
+      }
+    }
+
+    template<typename T, typename A>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::deque<T, A>& deque_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::deque<%s>", _underlying_name<T>());
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      // overwrite the elements already there, then construct the missing ones in place
+      auto iterator = deque_.begin();
+
+      if _stz_impl_CONSTEXPR_CPP17 (_static_size<T>::value != 0)
+      {
+        _stz_impl_SAFE(
+        if _stz_impl_ABNORMAL((_input.left() / _static_size<T>::value) < size)
+        {
+          return;
+        })
+
+        const Byte* raw_ptr = _input.front;
+        _input.front += _static_size<T>::value * size;
+
+        for (const auto end = deque_.end(); size && iterator != end; --size, ++iterator)
+        {
+          _drz_raw(raw_ptr, *iterator);
+        }
+        deque_.erase(iterator, deque_.end());
+
+        for (; size; --size)
+        {
+          _drz_raw(raw_ptr, _emplace_back(deque_));
+        }
+      }
+      else
+      {
+        for (const auto end = deque_.end(); size && iterator != end; --size, ++iterator)
+        {
+          _drz_impl(*iterator);
+        }
+        deque_.erase(iterator, deque_.end());
+
+        for (; size; --size)
+        {
+          _drz_impl(_emplace_back(deque_));
+        }
+      }
+    }
+
+    template<typename T1, typename T2>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::pair<T1, T2>& pair_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::pair<%s, %s>", _underlying_name<T1>(), _underlying_name<T2>());
+
+      if _stz_impl_CONSTEXPR_CPP17 (_static_size<std::pair<T1, T2>>::value != 0)
+      {
+        _srz_static(pair_);
+      }
+      else
+      {
+        _srz_impl(pair_.first);
+        _srz_impl(pair_.second);
+      }
+    }
+
+    template<typename T1, typename T2>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::pair<T1, T2>& pair_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::pair<%s, %s>", _underlying_name<T1>(), _underlying_name<T2>());
+
+      if _stz_impl_CONSTEXPR_CPP17 (_static_size<std::pair<T1, T2>>::value != 0)
+      {
+        _drz_static(pair_);
+      }
+      else
+      {
+        _drz_impl(pair_.first);
+        _drz_impl(pair_.second);
+      }
+    }
+
+    // the bucket count and maximum load factor are kept with STZ_PRESERVE_BUCKETS, else just enough buckets are reserved
+    template<class C>
+    void _srz_buckets(const C& container_) noexcept
+    {
+#   if defined(STZ_PRESERVE_BUCKETS)
+      const float max_load_factor = container_.max_load_factor();
+
+      _size_t_srz_impl(container_.bucket_count());
+      _srz_impl(max_load_factor);
+#   else
+      (void)container_;
+#   endif
+    }
+
+    template<class C>
+    void _drz_buckets(C& container_, const size_t size_) noexcept
+    {
+      container_.clear();
+
+      _stz_impl_STATS(const size_t bucket_count_before = container_.bucket_count());
+
+      // 'size_' comes from the input, no more elements are reserved for than there are bytes left to read
+      size_t elements = size_;
+      _stz_impl_SAFE(elements = std::min(size_, _input.left()));
+
+#   if defined(STZ_PRESERVE_BUCKETS)
+      size_t bucket_count = {};
+      _size_t_drz_impl(bucket_count);
+
+      float max_load_factor = container_.max_load_factor();
+      _drz_impl(max_load_factor);
+
+      // so do these, they are limited to as many buckets as the elements and the bytes left account for
+      _stz_impl_SAFE(
+      const size_t bound = elements + _input.left();
+
+      if _stz_impl_ABNORMAL(bucket_count > bound)
+      {
+        bucket_count = bound;
+      }
+
+      if _stz_impl_ABNORMAL(not (max_load_factor * static_cast<float>(bound) >= static_cast<float>(elements)))
+      {
+        max_load_factor = container_.max_load_factor();
+      })
+
+      _stz_impl_SAFE(
+      if _stz_impl_EXPECTED(max_load_factor > 0))
+      {
+        container_.max_load_factor(max_load_factor);
+      }
+
+      container_.rehash(bucket_count);
+#   else
+      container_.reserve(elements);
+#   endif
+
+      _stz_impl_STATS(
+      if (container_.bucket_count() != bucket_count_before)
+      {
+        ++_stats.container_allocations;
+        _stats.container_bytes += sizeof(void*) * container_.bucket_count();
+      })
+    }
+
+    template<typename T1, typename T2, class H, class E, class A>
+    constexpr
+    void _srz_impl(const std::unordered_map<T1, T2, H, E, A>& unordered_map_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::unordered_map");
+
+      _size_t_srz_impl(unordered_map_.size());
+      _srz_buckets(unordered_map_);
+
+      for (const auto& key_value : unordered_map_)
+      {
+        _srz_impl(key_value);
+      }
+    }
+
+    template<typename T1, typename T2, class H, class E, class A>
+    constexpr
+    void _drz_impl(std::unordered_map<T1, T2, H, E, A>& unordered_map_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::unordered_map");
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      _drz_buckets(unordered_map_, size);
+      _stz_impl_STATS(_count_nodes<std::unordered_map<T1, T2, H, E, A>>(size));
+
+      auto key_value = _allocated<std::pair<T1, T2>, A>::_make(unordered_map_.get_allocator());
+      for (size_t k = 0; k < size; ++k)
+      {
+        _drz_impl(key_value);
+        unordered_map_.insert(std::move(key_value));
+      }
+    }
+
+    template<typename T1, typename T2, class H, class E, class A>
+    constexpr
+    void _srz_impl(const std::unordered_multimap<T1, T2, H, E, A>& unordered_multimap_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::unordered_multimap");
+
+      _size_t_srz_impl(unordered_multimap_.size());
+      _srz_buckets(unordered_multimap_);
+
+      for (const auto& key_value : unordered_multimap_)
+      {
+        _srz_impl(key_value);
+      }
+    }
+
+    template<typename T1, typename T2, class H, class E, class A>
+    constexpr
+    void _drz_impl(std::unordered_multimap<T1, T2, H, E, A>& unordered_multimap_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::unordered_multimap");
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      _drz_buckets(unordered_multimap_, size);
+      _stz_impl_STATS(_count_nodes<std::unordered_multimap<T1, T2, H, E, A>>(size));
+
+      auto key_value = _allocated<std::pair<T1, T2>, A>::_make(unordered_multimap_.get_allocator());
+      for (size_t k = 0; k < size; ++k)
+      {
+        _drz_impl(key_value);
+        unordered_multimap_.insert(std::move(key_value));
+      }
+    }
+
+    template<typename T1, typename T2, class C, class A>
+    constexpr
+    void _srz_impl(const std::map<T1, T2, C, A>& map_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::map");
+
+      _size_t_srz_impl(map_.size());
+
+      for (const auto& key_value : map_)
+      {
+        _srz_impl(key_value);
+      }
+    }
+
+    template<typename T1, typename T2, class C, class A>
+    constexpr
+    void _drz_impl(std::map<T1, T2, C, A>& map_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::map");
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      map_.clear();
+
+      _stz_impl_STATS(_count_nodes<std::map<T1, T2, C, A>>(size));
+
+      // keys were serialized in order, a hint at end() makes each insertion amortized O(1)
+      auto key_value = _allocated<std::pair<T1, T2>, A>::_make(map_.get_allocator());
+      for (size_t k = 0; k < size; ++k)
+      {
+        _drz_impl(key_value);
+        map_.emplace_hint(map_.end(), std::move(key_value));
+      }
+    }
+
+    template<typename T1, typename T2, class C, class A>
+    constexpr
+    void _srz_impl(const std::multimap<T1, T2, C, A>& multimap_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::multimap");
+
+      _size_t_srz_impl(multimap_.size());
+
+      for (const auto& key_value : multimap_)
+      {
+        _srz_impl(key_value);
+      }
+    }
+
+    template<typename T1, typename T2, class C, class A>
+    constexpr
+    void _drz_impl(std::multimap<T1, T2, C, A>& multimap_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::multimap");
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      multimap_.clear();
+
+      _stz_impl_STATS(_count_nodes<std::multimap<T1, T2, C, A>>(size));
+
+      auto key_value = _allocated<std::pair<T1, T2>, A>::_make(multimap_.get_allocator());
+      for (size_t k = 0; k < size; ++k)
+      {
+        _drz_impl(key_value);
+        multimap_.emplace_hint(multimap_.end(), std::move(key_value));
+      }
+    }
+
+    template<typename T, class H, class E, class A>
+    constexpr
+    void _srz_impl(const std::unordered_set<T, H, E, A>& unordered_set_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::unordered_set");
+
+      _size_t_srz_impl(unordered_set_.size());
+      _srz_buckets(unordered_set_);
+
+      for (const auto& key : unordered_set_)
+      {
+        _srz_impl(key);
+      }
+    }
+
+    template<typename T, class H, class E, class A>
+    constexpr
+    void _drz_impl(std::unordered_set<T, H, E, A>& unordered_set_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::unordered_set");
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      _drz_buckets(unordered_set_, size);
+      _stz_impl_STATS(_count_nodes<std::unordered_set<T, H, E, A>>(size));
+
+      auto key = _allocated<T, A>::_make(unordered_set_.get_allocator());
+      for (size_t k = 0; k < size; ++k)
+      {
+        _drz_impl(key);
+        unordered_set_.insert(std::move(key));
+      }
+    }
+
+    template<typename T, class H, class E, class A>
+    constexpr
+    void _srz_impl(const std::unordered_multiset<T, H, E, A>& unordered_multiset_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::unordered_multiset");
+
+      _size_t_srz_impl(unordered_multiset_.size());
+      _srz_buckets(unordered_multiset_);
+
+      for (const auto& key : unordered_multiset_)
+      {
+        _srz_impl(key);
+      }
+    }
+
+    template<typename T, class H, class E, class A>
+    constexpr
+    void _drz_impl(std::unordered_multiset<T, H, E, A>& unordered_multiset_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::unordered_multiset");
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      _drz_buckets(unordered_multiset_, size);
+      _stz_impl_STATS(_count_nodes<std::unordered_multiset<T, H, E, A>>(size));
+
+      auto key = _allocated<T, A>::_make(unordered_multiset_.get_allocator());
+      for (size_t k = 0; k < size; ++k)
+      {
+        _drz_impl(key);
+        unordered_multiset_.insert(std::move(key));
+      }
+    }
+
+    template<typename T, class C, class A>
+    constexpr
+    void _srz_impl(const std::set<T, C, A>& set_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::set");
+
+      _size_t_srz_impl(set_.size());
+
+      for (const auto& key : set_)
+      {
+        _srz_impl(key);
+      }
+    }
+
+    template<typename T, class C, class A>
+    constexpr
+    void _drz_impl(std::set<T, C, A>& set_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::set");
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      set_.clear();
+
+      _stz_impl_STATS(_count_nodes<std::set<T, C, A>>(size));
+
+      auto key = _allocated<T, A>::_make(set_.get_allocator());
+      for (size_t k = 0; k < size; ++k)
+      {
+        _drz_impl(key);
+        set_.emplace_hint(set_.end(), std::move(key));
+      }
+    }
+
+    template<typename T, class C, class A>
+    constexpr
+    void _srz_impl(const std::multiset<T, C, A>& multiset_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::multiset");
+
+      _size_t_srz_impl(multiset_.size());
+
+      for (const auto& key : multiset_)
+      {
+        _srz_impl(key);
+      }
+    }
+
+    template<typename T, class C, class A>
+    constexpr
+    void _drz_impl(std::multiset<T, C, A>& multiset_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::multiset");
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      multiset_.clear();
+
+      _stz_impl_STATS(_count_nodes<std::multiset<T, C, A>>(size));
+
+      auto key = _allocated<T, A>::_make(multiset_.get_allocator());
+      for (size_t k = 0; k < size; ++k)
+      {
+        _drz_impl(key);
+        multiset_.emplace_hint(multiset_.end(), std::move(key));
+      }
+    }
+
+    template<typename T>
+    struct _is_run_length_able : std::false_type {};
+
+    template<typename T, typename A>
+    struct _is_run_length_able<std::vector<T, A>> : std::true_type {};
+
+    template<typename T, typename A>
+    struct _is_run_length_able<std::deque<T, A>> : std::true_type {};
+
+    template<typename T, typename A>
+    struct _is_run_length_able<std::list<T, A>> : std::true_type {};
+
+    template<typename T, typename A>
+    void _reserve(std::vector<T, A>& vector_, const size_t size_)
+    {
+      vector_.reserve(size_);
+    }
+
+    template<typename T>
+    void _reserve(T&, const size_t, ...)
+    {}
+
+    // defined along with the pointer tables
+    static size_t _srz_pointer_count() noexcept;
+
+    template<typename T>
+    void _srz_impl(const RunLength<T>& run_length_) noexcept
+    {
+      using container_type = typename std::remove_const<T>::type;
+
+      static_assert(_is_run_length_able<container_type>::value,
+        "stz: run_length: only std::vector, std::deque and std::list are supported."
+      );
+
+      _stz_impl_IDEBUGGING("run-length %s", _underlying_name<container_type>());
+
+      const auto& container = *run_length_.container_ptr;
+
+      _size_t_srz_impl(container.size());
+
+      auto       iterator = container.begin();
+      const auto end      = container.end();
+
+      if (iterator == end) return;
+
+      // the run's element is encoded once, following elements are encoded after it and compared bytewise
+      size_t run_front = _buffer.size();
+      _srz_impl(*iterator);
+      size_t run_bytes = _buffer.size() - run_front;
+      size_t run_count = 1;
+
+      for (++iterator;; ++iterator)
+      {
+        const size_t next_front = _buffer.size();
+
+        if (iterator != end)
+        {
+          const size_t pointers = _srz_pointer_count();
+          _srz_impl(*iterator);
+
+          // an element that met new pointees is kept, dropping its bytes would desynchronize the pointer table
+          const bool same_bytes = (_srz_pointer_count() == pointers)
+            && ((_buffer.size() - next_front) == run_bytes)
+            && (std::memcmp(_buffer.data() + run_front, _buffer.data() + next_front, run_bytes) == 0);
+
+          if (same_bytes)
+          {
+            _buffer.resize(next_front);
+            ++run_count;
+            continue;
+          }
+        }
+
+        // close the run by moving its count in front of its element
+        const size_t count_front = _buffer.size();
+        _size_t_srz_impl(run_count);
+        std::rotate(_buffer.begin() + run_front, _buffer.begin() + count_front, _buffer.end());
+
+        if (iterator == end) break;
+
+        run_front = next_front + (_buffer.size() - count_front);
+        run_bytes = count_front - next_front;
+        run_count = 1;
+      }
+    }
+
+    template<typename T>
+    void _drz_impl(RunLength<T>& run_length_) noexcept
+    {
+      static_assert(_is_run_length_able<T>::value,
+        "stz: run_length: only std::vector, std::deque and std::list are supported."
+      );
+
+      _stz_impl_IDEBUGGING("run-length %s", _underlying_name<T>());
+
+      auto& container = *run_length_.container_ptr;
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      container.clear();
+      _reserve(container, size);
+
+      for (size_t remaining = size; remaining;)
+      {
+        size_t count = {};
+        _size_t_drz_impl(count);
+
+        _stz_impl_SAFE(
+        if _stz_impl_ABNORMAL((count == 0) || (count > remaining))
+        {
+          return;
+        })
+
+        typename T::value_type value = {};
+        _drz_impl(value);
+
+        container.insert(container.end(), count, value);
+
+        remaining -= count;
+      }
+    }
+
+    template<typename T>
+    void _srz_impl(const RunLength<T>&& run_length_) noexcept
+    {
+      _srz_impl(run_length_);
+    }
+
+    template<typename T>
+    void _drz_impl(RunLength<T>&& run_length_) noexcept
+    {
+      _drz_impl(run_length_);
+    }
+
+    template<typename T>
+    struct _is_node_reusable : std::false_type {};
+
+    template<typename T1, typename T2, class C, class A>
+    struct _is_node_reusable<std::map<T1, T2, C, A>> : std::true_type {};
+
+    template<typename T1, typename T2, class C, class A>
+    struct _is_node_reusable<std::multimap<T1, T2, C, A>> : std::true_type {};
+
+    template<typename T, class C, class A>
+    struct _is_node_reusable<std::set<T, C, A>> : std::true_type {};
+
+    template<typename T, class C, class A>
+    struct _is_node_reusable<std::multiset<T, C, A>> : std::true_type {};
+
+    template<typename T1, typename T2, class H, class E, class A>
+    struct _is_node_reusable<std::unordered_map<T1, T2, H, E, A>> : std::true_type {};
+
+    template<typename T1, typename T2, class H, class E, class A>
+    struct _is_node_reusable<std::unordered_multimap<T1, T2, H, E, A>> : std::true_type {};
+
+    template<typename T, class H, class E, class A>
+    struct _is_node_reusable<std::unordered_set<T, H, E, A>> : std::true_type {};
+
+    template<typename T, class H, class E, class A>
+    struct _is_node_reusable<std::unordered_multiset<T, H, E, A>> : std::true_type {};
+
+    template<class C, typename = void>
+    struct _has_mapped : std::false_type {};
+
+    template<class C>
+    struct _has_mapped<C, typename std::conditional<true, void, typename C::mapped_type>::type> : std::true_type {};
+
+    template<class C, typename = void>
+    struct _has_hasher : std::false_type {};
+
+    template<class C>
+    struct _has_hasher<C, typename std::conditional<true, void, typename C::hasher>::type> : std::true_type {};
+
+    template<typename T>
+    void _srz_impl(const NodeReuse<T>& node_reuse_) noexcept
+    {
+      static_assert(_is_node_reusable<typename std::remove_const<T>::type>::value,
+        "stz: node_reuse: only std::map, std::set, std::unordered_map, std::unordered_set and their multi variants are supported."
+      );
+
+      _srz_impl(*node_reuse_.container_ptr);
+    }
+
+# if __cplusplus >= 201703L
+    template<typename N>
+    auto _drz_node(N& node_) noexcept -> decltype(void(node_.mapped()))
+    {
+      _drz_impl(node_.key());
+      _drz_impl(node_.mapped());
+    }
+
+    template<typename N>
+    auto _drz_node(N& node_) noexcept -> decltype(void(node_.value()))
+    {
+      _drz_impl(node_.value());
+    }
+
+    template<class C>
+    void _drz_reused_buckets(C& container_, const size_t size_, std::true_type) noexcept
+    {
+      _drz_buckets(container_, size_);
+    }
+
+    template<class C>
+    void _drz_reused_buckets(C&, const size_t, std::false_type) noexcept
+    {}
+
+    template<class C, bool = _has_mapped<C>::value>
+    struct _node_value
+    {
+      using type = std::pair<typename C::key_type, typename C::mapped_type>;
+    };
+
+    template<class C>
+    struct _node_value<C, false>
+    {
+      using type = typename C::key_type;
+    };
+
+    // every node is detached, then refilled with a deserialized element and attached again
+    template<typename T>
+    void _drz_impl(NodeReuse<T>& node_reuse_) noexcept
+    {
+      static_assert(_is_node_reusable<T>::value,
+        "stz: node_reuse: only std::map, std::set, std::unordered_map, std::unordered_set and their multi variants are supported."
+      );
+
+      _stz_impl_IDEBUGGING("node-reusing %s", _underlying_name<T>());
+
+      auto& container = *node_reuse_.container_ptr;
+
+      // kept per thread so that reloads of the same size allocate nothing once warm
+      static _stz_impl_THREADLOCAL std::vector<typename T::node_type> nodes;
+
+      while (not container.empty())
+      {
+        nodes.push_back(container.extract(container.begin()));
+      }
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      // unordered containers keep their buckets, already sized for the previous elements
+      _drz_reused_buckets(container, size, _has_hasher<T>());
+
+      for (; size; --size)
+      {
+        if (nodes.empty())
+        {
+          // built with the container's allocator, as the nodes it replaces were
+          auto value = _allocated<typename _node_value<T>::type, typename T::allocator_type>::_make(container.get_allocator());
+
+          _stz_impl_STATS(_count_nodes<T>(1));
+          _drz_impl(value);
+          container.emplace_hint(container.end(), std::move(value));
+        }
+        else
+        {
+          _drz_node(nodes.back());
+          container.insert(container.end(), std::move(nodes.back()));
+          nodes.pop_back();
+        }
+      }
+
+      // the nodes left over are freed
+      nodes.clear();
+    }
+# else
+    // keys come sorted, the nodes whose key is deserialized again are kept and only their mapped value is overwritten
+    template<typename T>
+    void _drz_merge(T& container_, size_t size_, std::true_type) noexcept
+    {
+      auto iterator = container_.begin();
+
+      auto key = _allocated<typename T::key_type, typename T::allocator_type>::_make(container_.get_allocator());
+      for (; size_; --size_)
+      {
+        _drz_impl(key);
+
+        while ((iterator != container_.end()) and container_.key_comp()(iterator->first, key))
+        {
+          iterator = container_.erase(iterator);
+        }
+
+        if ((iterator == container_.end()) or container_.key_comp()(key, iterator->first))
+        {
+          iterator = container_.emplace_hint(iterator, std::move(key),
+            _allocated<typename T::mapped_type, typename T::allocator_type>::_make(container_.get_allocator()));
+          _stz_impl_STATS(_count_nodes<T>(1));
+        }
+
+        _drz_impl(iterator->second);
+        ++iterator;
+      }
+
+      container_.erase(iterator, container_.end());
+    }
+
+    template<typename T>
+    void _drz_merge(T& container_, size_t size_, std::false_type) noexcept
+    {
+      auto iterator = container_.begin();
+
+      auto key = _allocated<typename T::key_type, typename T::allocator_type>::_make(container_.get_allocator());
+      for (; size_; --size_)
+      {
+        _drz_impl(key);
+
+        while ((iterator != container_.end()) and container_.key_comp()(*iterator, key))
+        {
+          iterator = container_.erase(iterator);
+        }
+
+        if ((iterator == container_.end()) or container_.key_comp()(key, *iterator))
+        {
+          iterator = container_.emplace_hint(iterator, std::move(key));
+          _stz_impl_STATS(_count_nodes<T>(1));
+        }
+
+        ++iterator;
+      }
+
+      container_.erase(iterator, container_.end());
+    }
+
+    template<typename T>
+    void _drz_reuse(T& container_, std::false_type) noexcept
+    {
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      _drz_merge(container_, size, _has_mapped<T>());
+    }
+
+    // without node handles, unordered containers are deserialized into as usual
+    template<typename T>
+    void _drz_reuse(T& container_, std::true_type) noexcept
+    {
+      _drz_impl(container_);
+    }
+
+    template<typename T>
+    void _drz_impl(NodeReuse<T>& node_reuse_) noexcept
+    {
+      static_assert(_is_node_reusable<T>::value,
+        "stz: node_reuse: only std::map, std::set, std::unordered_map, std::unordered_set and their multi variants are supported."
+      );
+
+      _stz_impl_IDEBUGGING("node-reusing %s", _underlying_name<T>());
+
+      auto& container = *node_reuse_.container_ptr;
+
+      _drz_reuse(container, _has_hasher<T>());
+    }
+# endif
+
+    template<typename T>
+    void _srz_impl(const NodeReuse<T>&& node_reuse_) noexcept
+    {
+      _srz_impl(node_reuse_);
+    }
+
+    template<typename T>
+    void _drz_impl(NodeReuse<T>&& node_reuse_) noexcept
+    {
+      _drz_impl(node_reuse_);
+    }
+
+    // compile-time sizes of the elements, terminated by a 0 so that every run ends
+    template<typename... T>
+    constexpr
+    auto _tuple_sizes() noexcept -> _size_list<sizeof...(T) + 1>
+    {
+      return _size_list<sizeof...(T) + 1>{{_static_size<_bare<T>>::value..., 0}};
+    }
+
+    // contiguous elements of static size are bounded once and written through a single pointer
+    template<size_t I, typename... T>
+    void _srz_tuple_element(const std::tuple<T...>& tuple_, Byte*& raw_ptr_) noexcept
+    {
+      using run = std::integral_constant<size_t, _static_run(_tuple_sizes<T...>(), I)>;
+
+      if (run::value == 0)
+      {
+        _srz_impl(std::get<I>(tuple_));
+        return;
+      }
+
+      if (_starts_run(_tuple_sizes<T...>(), I))
+      {
+        const size_t front = _buffer.size();
+        _stz_impl_REGROWTH(_buffer.resize(front + run::value));
+        raw_ptr_ = _buffer.data() + front;
+      }
+
+      _srz_raw(raw_ptr_, std::get<I>(tuple_));
+    }
+
+    template<size_t I, typename... T>
+    void _drz_tuple_element(std::tuple<T...>& tuple_, const Byte*& raw_ptr_) noexcept
+    {
+      using run = std::integral_constant<size_t, _static_run(_tuple_sizes<T...>(), I)>;
+
+      if (run::value == 0)
+      {
+        _drz_impl(std::get<I>(tuple_));
+        return;
+      }
+
+      if (_starts_run(_tuple_sizes<T...>(), I))
+      {
+        raw_ptr_ = nullptr;
+
+        _stz_impl_SAFE(
+        if _stz_impl_ABNORMAL(_input.left() < run::value)
+        {
+          return;
+        })
+
+        raw_ptr_       = _input.front;
+        _input.front += run::value;
+      }
+
+      _stz_impl_SAFE(
+      if _stz_impl_ABNORMAL(raw_ptr_ == nullptr)
+      {
+        return;
+      })
+
+      _drz_raw(raw_ptr_, std::get<I>(tuple_));
+    }
+
+    template<typename... T, size_t... I>
+    void _srz_tuple(const std::tuple<T...>& tuple_, _index_sequence<I...>) noexcept
+    {
+      _stz_impl_MAYBE_UNUSED Byte* raw_ptr = nullptr;
+      (void)_expand{0, (_srz_tuple_element<I>(tuple_, raw_ptr), 0)...};
+    }
+
+    template<typename... T, size_t... I>
+    void _drz_tuple(std::tuple<T...>& tuple_, _index_sequence<I...>) noexcept
+    {
+      _stz_impl_MAYBE_UNUSED const Byte* raw_ptr = nullptr;
+      (void)_expand{0, (_drz_tuple_element<I>(tuple_, raw_ptr), 0)...};
+    }
+
+    template<typename... T>
+    _stz_impl_CONSTEXPR_CPP14
+    void _srz_impl(const std::tuple<T...>& tuple_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::tuple");
+
+      _srz_tuple(tuple_, _make_index_sequence<sizeof...(T)>());
+    }
+
+    template<typename... T>
+    _stz_impl_CONSTEXPR_CPP14
+    void _drz_impl(std::tuple<T...>& tuple_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::tuple");
+
+      _drz_tuple(tuple_, _make_index_sequence<sizeof...(T)>());
+    }
+
+# if __cplusplus >= 201703L
+    template<typename T>
+    auto _srz_impl(const T& aggregates_, const size_t N_) noexcept -> _if_reflected<T>
+    {
+      _stz_impl_IDEBUGGING((N_ > 1) ? "%s x%zu" : "%s", _underlying_name<T>(), N_);
+
+      static_assert(_has_tied_fields<T>::value,
+        "stz: aggregates with base classes, more than 32 fields or fields that cannot be counted need serialization_sequential(...) unless they are trivially copyable."
+      );
+
+      if constexpr (_has_tied_fields<T>::value)
+      {
+        for (size_t k = 0; k < N_; ++k)
+        {
+          const auto fields = _tie_fields((&aggregates_)[k]);
+          _srz_tuple(fields, _make_index_sequence<std::tuple_size<decltype(fields)>::value>());
+        }
+      }
+    }
+
+    template<typename T>
+    auto _drz_impl(T& aggregates_, const size_t N_) noexcept -> _if_reflected<T>
+    {
+      _stz_impl_IDEBUGGING((N_ > 1) ? "%s x%zu" : "%s", _underlying_name<T>(), N_);
+
+      static_assert(_has_tied_fields<T>::value,
+        "stz: aggregates with base classes, more than 32 fields or fields that cannot be counted need serialization_sequential(...) unless they are trivially copyable."
+      );
+
+      if constexpr (_has_tied_fields<T>::value)
+      {
+        for (size_t k = 0; k < N_; ++k)
+        {
+          auto fields = _tie_fields((&aggregates_)[k]);
+          _drz_tuple(fields, _make_index_sequence<std::tuple_size<decltype(fields)>::value>());
+        }
+      }
+    }
+# endif
+
+# if __cplusplus >= 201703L
+    // a presence byte, then the value if there is one
+    template<typename T>
+    void _srz_impl(const std::optional<T>& optional_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::optional<%s>", _underlying_name<T>());
+
+      _stz_impl_REGROWTH(_buffer.push_back(static_cast<Byte>(optional_.has_value())));
+
+      if (optional_.has_value())
+      {
+        _srz_impl(*optional_);
+      }
+    }
+
+    template<typename T>
+    void _drz_impl(std::optional<T>& optional_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::optional<%s>", _underlying_name<T>());
+
+      _stz_impl_SAFE(
+      if _stz_impl_ABNORMAL(_input.left() == 0)
+      {
+        return;
+      })
+
+      if (*_input.front++ == 0)
+      {
+        optional_.reset();
+        return;
+      }
+
+      // the current value is reused
+      if (optional_.has_value() == false)
+      {
+        optional_.emplace();
+      }
+
+      _drz_impl(*optional_);
+    }
+
+    template<size_t I, typename... T>
+    void _srz_alternative(const std::variant<T...>& variant_) noexcept
+    {
+      _srz_impl(*std::get_if<I>(&variant_));
+    }
+
+    template<size_t I, typename... T>
+    void _drz_alternative(std::variant<T...>& variant_) noexcept
+    {
+      // the current alternative is reused
+      if (variant_.index() != I)
+      {
+        variant_.template emplace<I>();
+      }
+
+      _drz_impl(*std::get_if<I>(&variant_));
+    }
+
+    template<typename... T, size_t... I>
+    void _srz_variant(const std::variant<T...>& variant_, _index_sequence<I...>) noexcept
+    {
+      static constexpr void (*alternatives[])(const std::variant<T...>&) = {&_srz_alternative<I, T...>...};
+
+      alternatives[variant_.index()](variant_);
+    }
+
+    template<typename... T, size_t... I>
+    void _drz_variant(std::variant<T...>& variant_, const size_t index_, _index_sequence<I...>) noexcept
+    {
+      static constexpr void (*alternatives[])(std::variant<T...>&) = {&_drz_alternative<I, T...>...};
+
+      alternatives[index_](variant_);
+    }
+
+    // the index of the alternative, then the alternative
+    template<typename... T>
+    void _srz_impl(const std::variant<T...>& variant_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::variant<...>");
+
+      if _stz_impl_ABNORMAL(variant_.valueless_by_exception())
+      {
+        _size_t_srz_impl(sizeof...(T));
+        return;
+      }
+
+      _size_t_srz_impl(variant_.index());
+      _srz_variant(variant_, _make_index_sequence<sizeof...(T)>());
+    }
+
+    template<typename... T>
+    void _drz_impl(std::variant<T...>& variant_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::variant<...>");
+
+      size_t index = sizeof...(T);
+      _size_t_drz_impl(index);
+
+      // also reached by variants that were valueless when serialized
+      if _stz_impl_ABNORMAL(index >= sizeof...(T))
+      {
+        return;
+      }
+
+      _drz_variant(variant_, index, _make_index_sequence<sizeof...(T)>());
+    }
+
+    constexpr
+    void _srz_impl(const std::monostate&) noexcept
+    {}
+
+    constexpr
+    void _drz_impl(std::monostate&) noexcept
+    {}
+
+    template<typename T, typename Tr>
+    void _srz_impl(const std::basic_string_view<T, Tr>& string_view_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::basic_string_view<%s>", _underlying_name<T>());
+
+      _size_t_srz_impl(string_view_.size());
+
+      if (string_view_.empty())
+      {
+        return;
+      }
+
+      if constexpr (std::is_fundamental<T>::value)
+      {
+        _srz_impl_many_fundamentals(string_view_[0], string_view_.size());
+      }
+      else
+      {
+        for (const auto character : string_view_)
+        {
+          _srz_impl(character);
+        }
+      }
+    }
+# endif
+
+    // identifies a pointee type without RTTI
+    template<typename T>
+    struct _type_tag
+    {
+      static const char id;
+    };
+
+    template<typename T>
+    const char _type_tag<T>::id = 0;
+
+    template<typename T>
+    constexpr
+    auto _pointer_tag() noexcept -> const char*
+    {
+      return &_type_tag<_bare<T>>::id;
+    }
+
+    struct _pointer_key
+    {
+      const void* address;
+      const char* tag;
+
+      bool operator==(const _pointer_key& other_) const noexcept
+      {
+        return (address == other_.address) and (tag == other_.tag);
+      }
+    };
+
+    struct _pointer_hash
+    {
+      size_t operator()(const _pointer_key& key_) const noexcept
+      {
+        return std::hash<const void*>()(key_.address) ^ (std::hash<const void*>()(key_.tag) << 1);
+      }
+    };
+
+    struct _pointer_entry
+    {
+      void*                 address;
+      const char*           tag;
+      std::shared_ptr<void> owner; // set once a std::shared_ptr owns the pointee
+      bool                  owned; // set once a smart pointer owns the pointee
+    };
+
+    // pointees met during the current serialization/deserialization, each one is written once
+    static _stz_impl_THREADLOCAL std::unordered_map<_pointer_key, size_t, _pointer_hash> _srz_pointers;
+    static _stz_impl_THREADLOCAL std::vector<_pointer_entry>                               _drz_pointers;
+
+    _stz_impl_MAYBE_UNUSED
+    static
+    void _clear_pointers() noexcept
+    {
+      if (not _srz_pointers.empty()) _srz_pointers.clear();
+      if (not _drz_pointers.empty()) _drz_pointers.clear();
+    }
+
+    size_t _srz_pointer_count() noexcept
+    {
+      return _srz_pointers.size();
+    }
+
+    // specialized by STZ_MAKE_POLYMORPHIC(B, ...)
+    template<typename B>
+    struct _polymorphic : std::false_type
+    {
+      static constexpr size_t count = 1;
+    };
+
+# if __cplusplus < 201703L
+    template<typename B>
+    constexpr size_t _polymorphic<B>::count;
+# endif
+
+    template<typename B>
+    struct _polymorphic_type
+    {
+      const std::type_info* info;
+      B*                  (*make)() noexcept;
+      void                (*srz)(const B&) noexcept;
+      void                (*drz)(B&) noexcept;
+    };
+
+    template<typename B, typename D>
+    auto _polymorphic_make() noexcept -> typename std::enable_if<std::is_abstract<D>::value != true, B*>::type
+    {
+      _stz_impl_STATS(++_stats.pointee_allocations);
+      return new D();
+    }
+
+    template<typename B, typename D>
+    auto _polymorphic_make() noexcept -> typename std::enable_if<std::is_abstract<D>::value == true, B*>::type
+    {
+      return nullptr;
+    }
+
+    template<typename B, typename D>
+    void _polymorphic_srz(const B& base_) noexcept
+    {
+      _srz_impl(static_cast<const D&>(base_));
+    }
+
+    template<typename B, typename D>
+    void _polymorphic_drz(B& base_) noexcept
+    {
+      _drz_impl(static_cast<D&>(base_));
+    }
+
+    // ids are indices in the list: 0 for 'B', then 1, 2, ... for 'D...'
+    template<typename B, typename... D>
+    struct _polymorphic_registry : std::true_type
+    {
+      static constexpr size_t count = 1 + sizeof...(D);
+
+      static
+      auto types() noexcept -> const _polymorphic_type<B>*
+      {
+        static const _polymorphic_type<B> table[] = {
+          {&typeid(B), &_polymorphic_make<B, B>, &_polymorphic_srz<B, B>, &_polymorphic_drz<B, B>},
+          {&typeid(D), &_polymorphic_make<B, D>, &_polymorphic_srz<B, D>, &_polymorphic_drz<B, D>}...
+        };
+
+        return table;
+      }
+
+      // 'count' if the dynamic type of 'base_' is not registered
+      static
+      size_t id(const B& base_) noexcept
+      {
+        const std::type_info& info = typeid(base_);
+
+        // few types are registered in general, comparing addresses beats hashing them
+        if (count <= 8)
+        {
+          for (size_t k = 0; k < count; ++k)
+          {
+            if (types()[k].info == &info) return k;
+          }
+        }
+        else
+        {
+          static const std::unordered_map<const std::type_info*, size_t> ids = []
+          {
+            std::unordered_map<const std::type_info*, size_t> map;
+
+            for (size_t k = 0; k < count; ++k)
+            {
+              map.emplace(types()[k].info, k);
+            }
+
+            return map;
+          }();
+
+          const auto found = ids.find(&info);
+          if _stz_impl_EXPECTED(found != ids.end())
+          {
+            return found->second;
+          }
+        }
+
+        // type_info objects are not guaranteed to be unique across shared libraries
+        for (size_t k = 0; k < count; ++k)
+        {
+          if (*types()[k].info == info) return k;
+        }
+
+        return count;
+      }
+    };
+
+# if __cplusplus < 201703L
+    template<typename B, typename... D>
+    constexpr size_t _polymorphic_registry<B, D...>::count;
+# endif
+
+    template<typename T>
+    constexpr
+    size_t _dynamic_id(const T&, std::false_type) noexcept
+    {
+      return 0;
+    }
+
+    template<typename T>
+    size_t _dynamic_id(const T& pointee_, std::true_type) noexcept
+    {
+      return _polymorphic<_bare<T>>::id(pointee_);
+    }
+
+    template<typename T>
+    void _srz_pointee(const T& pointee_, size_t, std::false_type) noexcept
+    {
+      _srz_impl(pointee_);
+    }
+
+    template<typename T>
+    void _srz_pointee(const T& pointee_, const size_t id_, std::true_type) noexcept
+    {
+      _size_t_srz_impl(id_);
+      _polymorphic<_bare<T>>::types()[id_].srz(pointee_);
+    }
+
+    // 0: nullptr, 1: the pointee follows, n: same pointee as the (n - 2)th one written
+    template<typename T>
+    void _srz_pointer(const T* const pointer_) noexcept
+    {
+      _stz_impl_IDEBUGGING("pointer to %s", _underlying_name<T>());
+
+      if (pointer_ == nullptr)
+      {
+        _size_t_srz_impl(0);
+        return;
+      }
+
+      const size_t id = _dynamic_id(*pointer_, _polymorphic<_bare<T>>());
+
+      if _stz_impl_ABNORMAL(id == _polymorphic<_bare<T>>::count)
+      {
+        _stz_impl_WARNING("dynamic type of pointee not registered with STZ_MAKE_POLYMORPHIC, written as nullptr.");
+        _size_t_srz_impl(0);
+        return;
+      }
+
+      // registered before the pointee is written so that cycles end in a reference
+      const auto emplaced = _srz_pointers.emplace(_pointer_key{pointer_, _pointer_tag<T>()}, _srz_pointers.size());
+
+      if (emplaced.second == false)
+      {
+        _size_t_srz_impl(emplaced.first->second + 2);
+        return;
+      }
+
+      _size_t_srz_impl(1);
+      _srz_pointee(*pointer_, id, _polymorphic<_bare<T>>());
+    }
+
+    // entry of a pointee already read, nullptr if the reference is invalid
+    template<typename T>
+    auto _drz_reference(const size_t reference_) noexcept -> _pointer_entry*
+    {
+      _stz_impl_SAFE(
+      if _stz_impl_ABNORMAL((reference_ - 2 >= _drz_pointers.size()) or (_drz_pointers[reference_ - 2].tag != _pointer_tag<T>()))
+      {
+        return nullptr;
+      })
+
+      return &_drz_pointers[reference_ - 2];
+    }
+
+    // false if the id read is invalid
+    template<typename T>
+    constexpr
+    bool _drz_dynamic_id(size_t&, std::false_type) noexcept
+    {
+      return true;
+    }
+
+    template<typename T>
+    bool _drz_dynamic_id(size_t& id_, std::true_type) noexcept
+    {
+      id_ = _polymorphic<_bare<T>>::count;
+      _size_t_drz_impl(id_);
+
+      return (id_ < _polymorphic<_bare<T>>::count) and (_polymorphic<_bare<T>>::types()[id_].make != nullptr);
+    }
+
+    template<typename T>
+    auto _make_pointee(size_t, std::false_type) noexcept -> T*
+    {
+      _stz_impl_STATS(++_stats.pointee_allocations);
+      return new T();
+    }
+
+    template<typename T>
+    auto _make_pointee(const size_t id_, std::true_type) noexcept -> T*
+    {
+      return _polymorphic<T>::types()[id_].make();
+    }
+
+    template<typename T>
+    constexpr
+    bool _reusable_pointee(const T&, size_t, std::false_type) noexcept
+    {
+      return true;
+    }
+
+    template<typename T>
+    bool _reusable_pointee(const T& pointee_, const size_t id_, std::true_type) noexcept
+    {
+      return typeid(pointee_) == *_polymorphic<_bare<T>>::types()[id_].info;
+    }
+
+    template<typename T>
+    auto _make_shared_pointee(size_t, std::false_type) noexcept -> std::shared_ptr<T>
+    {
+      _stz_impl_STATS(++_stats.pointee_allocations);
+      return std::make_shared<T>();
+    }
+
+    template<typename T>
+    auto _make_shared_pointee(const size_t id_, std::true_type) noexcept -> std::shared_ptr<T>
+    {
+      return std::shared_ptr<T>(_polymorphic<T>::types()[id_].make());
+    }
+
+    template<typename T>
+    void _drz_pointee(T& pointee_, size_t, std::false_type) noexcept
+    {
+      _drz_impl(pointee_);
+    }
+
+    template<typename T>
+    void _drz_pointee(T& pointee_, const size_t id_, std::true_type) noexcept
+    {
+      _polymorphic<T>::types()[id_].drz(pointee_);
+    }
+
+    template<typename T>
+    void _srz_impl(T* const& pointer_) noexcept
+    {
+      _srz_pointer(pointer_);
+    }
+
+    // pointees are allocated with new and owned by the caller, unless a smart pointer refers to them as well
+    template<typename T>
+    void _drz_impl(T*& pointer_) noexcept
+    {
+      _stz_impl_IDEBUGGING("pointer to %s", _underlying_name<T>());
+
+      using U = typename std::remove_const<T>::type;
+
+      size_t reference = 0;
+      _size_t_drz_impl(reference);
+
+      if (reference == 0)
+      {
+        pointer_ = nullptr;
+      }
+      else if (reference == 1)
+      {
+        size_t id = 0;
+        if _stz_impl_ABNORMAL(_drz_dynamic_id<U>(id, _polymorphic<U>()) == false)
+        {
+          pointer_ = nullptr;
+          return;
+        }
+
+        U* const pointee = _make_pointee<U>(id, _polymorphic<U>());
+        pointer_ = pointee;
+
+        _drz_pointers.push_back(_pointer_entry{pointee, _pointer_tag<T>(), nullptr, false});
+        _drz_pointee(*pointee, id, _polymorphic<U>());
+      }
+      else if (const auto entry = _drz_reference<T>(reference))
+      {
+        pointer_ = static_cast<U*>(entry->address);
+      }
+    }
 
-    // Helper to check if a single type is non-const
     template<typename T>
-    struct _is_mutable : std::integral_constant<bool, not std::is_const<_strip<T>>::value>
-    {};
+    void _srz_impl(const std::unique_ptr<T>& unique_ptr_) noexcept
+    {
+      _srz_pointer(unique_ptr_.get());
+    }
 
-    // Recursive template to check if all types are non-const
-    template<typename... T_>
-    struct _all_mutable;
+    template<typename T>
+    void _drz_impl(std::unique_ptr<T>& unique_ptr_) noexcept
+    {
+      _stz_impl_IDEBUGGING("std::unique_ptr<%s>", _underlying_name<T>());
 
-    template<typename T, typename... T_>
-    struct _all_mutable<T, T_...> : std::integral_constant<bool, _is_mutable<T>::value && _all_mutable<T_...>::value>
-    {};
+      using U = typename std::remove_const<T>::type;
 
-    template<>
-    struct _all_mutable<> : std::true_type
-    {};
+      size_t reference = 0;
+      _size_t_drz_impl(reference);
 
-    // _if_mutable type alias
-    template<typename... T_>
-    using _if_mutable = typename std::enable_if<_all_mutable<T_...>::value>::type;
+      if (reference == 0)
+      {
+        unique_ptr_.reset();
+      }
+      else if (reference == 1)
+      {
+        size_t id = 0;
+        if _stz_impl_ABNORMAL(_drz_dynamic_id<U>(id, _polymorphic<U>()) == false)
+        {
+          unique_ptr_.reset();
+          return;
+        }
 
-    constexpr int _srz_dispatch() noexcept { return 0; }
+        // the current pointee is reused if its dynamic type matches
+        if ((unique_ptr_ == nullptr) or (_reusable_pointee(*unique_ptr_, id, _polymorphic<U>()) == false))
+        {
+          unique_ptr_.reset(_make_pointee<U>(id, _polymorphic<U>()));
+        }
 
-    template<typename T, typename... T_>
-    constexpr
-    void _srz_dispatch(T&& thing_, T_&&... things_) noexcept
-    {
-      _srz_impl(std::forward<const T>(thing_));
-      _srz_dispatch(std::forward<const T_>(things_)...);
-    }
+        _drz_pointers.push_back(_pointer_entry{&as_mutable(*unique_ptr_), _pointer_tag<T>(), nullptr, true});
+        _drz_pointee(as_mutable(*unique_ptr_), id, _polymorphic<U>());
+      }
+      else if (const auto entry = _drz_reference<T>(reference))
+      {
+        // a pointee cannot have two owners
+        if _stz_impl_ABNORMAL(entry->owned)
+        {
+          unique_ptr_.reset();
+          return;
+        }
 
-    constexpr int _drz_dispatch() noexcept { return 0; }
+        unique_ptr_.reset(static_cast<U*>(entry->address));
+        entry->owned = true;
+      }
+    }
 
-    template<typename T, typename... T_, typename = _if_mutable<T, T_...>>
-    constexpr
-    void _drz_dispatch(T&& thing_, T_&&... things_) noexcept
+    template<typename T>
+    void _srz_impl(const std::shared_ptr<T>& shared_ptr_) noexcept
     {
-      _drz_impl(std::forward<T>(thing_));
-      _drz_dispatch(std::forward<T_>(things_)...);
+      _srz_pointer(shared_ptr_.get());
     }
 
-    struct _srz
+    template<typename T>
+    void _drz_impl(std::shared_ptr<T>& shared_ptr_) noexcept
     {
-      struct _ver
+      _stz_impl_IDEBUGGING("std::shared_ptr<%s>", _underlying_name<T>());
+
+      using U = typename std::remove_const<T>::type;
+
+      size_t reference = 0;
+      _size_t_drz_impl(reference);
+
+      if (reference == 0)
       {
-        template<typename type>
-        void operator=(const type version_) noexcept
+        shared_ptr_.reset();
+      }
+      else if (reference == 1)
+      {
+        size_t id = 0;
+        if _stz_impl_ABNORMAL(_drz_dynamic_id<U>(id, _polymorphic<U>()) == false)
         {
-          _version = static_cast<size_t>(version_);
-
-          _stz_impl_SAFE(
-          if (version_ < static_cast<type>(0))
-          {
-            _stz_impl_WARNING("invalid 'serializer.version' value (%zu).", _version);
-            _version = static_cast<type>(-1);
-          } else)
-          {
-            _size_t_srz_impl(_version);
-          }
+          shared_ptr_.reset();
+          return;
         }
 
-        _stz_impl_UNSAFE(constexpr)
-        bool operator<(size_t) const noexcept
+        // the current pointee is reused only if nothing else shares it and its dynamic type matches
+        if ((shared_ptr_ == nullptr) or (shared_ptr_.use_count() != 1)
+          or (_reusable_pointee(*shared_ptr_, id, _polymorphic<U>()) == false))
         {
-          _stz_impl_SAFE(
-          if (_version == static_cast<size_t>(-1))
-          {
-            _stz_impl_WARNING("'serializer.version' was not set properly before usage.");
-          })
-
-          return false;
+          shared_ptr_ = _make_shared_pointee<U>(id, _polymorphic<U>());
         }
 
-        _stz_impl_UNSAFE(constexpr)
-        bool operator<=(size_t) const noexcept
-        {
-          _stz_impl_SAFE(
-          if (_version == static_cast<size_t>(-1))
-          {
-            _stz_impl_WARNING("'serializer.version' was not set properly before usage.");
-          })
+        _drz_pointers.push_back(_pointer_entry{&as_mutable(*shared_ptr_), _pointer_tag<T>(), shared_ptr_, true});
+        _drz_pointee(as_mutable(*shared_ptr_), id, _polymorphic<U>());
+      }
+      else if (const auto entry = _drz_reference<T>(reference))
+      {
+        const auto pointee = static_cast<U*>(entry->address);
 
-          return false;
+        if (entry->owner != nullptr)
+        {
+          shared_ptr_ = std::shared_ptr<T>(entry->owner, pointee);
         }
-
-        _stz_impl_UNSAFE(constexpr)
-        bool operator>(size_t) const noexcept
+        else if (entry->owned == false)
         {
-          _stz_impl_SAFE(
-          if (_version == static_cast<size_t>(-1))
-          {
-            _stz_impl_WARNING("'serializer.version' was not set properly before usage.");
-          })
-
-          return true;
+          shared_ptr_.reset(pointee);
+          entry->owner = shared_ptr_;
+          entry->owned = true;
         }
-
-        _stz_impl_UNSAFE(constexpr)
-        bool operator>=(size_t) const noexcept
+        else // owned by a std::unique_ptr, shared without ownership
         {
-          _stz_impl_SAFE(
-          if (_version == static_cast<size_t>(-1))
-          {
-            _stz_impl_WARNING("'serializer.version' was not set properly before usage.");
-            std::exit(-1);
-          })
-
-          return true;
+          shared_ptr_ = std::shared_ptr<T>(std::shared_ptr<T>(), pointee);
         }
+      }
+    }
 
-      private:
-        size_t _version = static_cast<size_t>(-1);
-      };
+# if defined(_stz_impl_THREADSAFE)
+    // set by parallel_deserialize(...) for the chunks of chunked(...) containers to be decoded across
+    static _stz_impl_THREADLOCAL Pool* _drz_pool = nullptr;
+# endif
 
-      void operator<=(_ver) const = delete;
-      void operator, (_ver) const = delete;
+    template<typename T>
+    struct _is_chunkable : std::false_type {};
 
-      _ver version;
+    template<typename T, typename A>
+    struct _is_chunkable<std::vector<T, A>> : std::true_type {};
 
-      template<typename type>
-      constexpr
-      _srz operator<=(const type& thing_) const &
+    template<typename A>
+    struct _is_chunkable<std::vector<bool, A>> : std::false_type {};
+
+    // chunks hold at least _chunked_grain elements, there are at most _chunked_chunks of them
+    constexpr size_t _chunked_grain  = 1024;
+    constexpr size_t _chunked_chunks = 64;
+
+    constexpr
+    size_t _chunk_first(const size_t k_, const size_t size_, const size_t count_) noexcept
+    {
+      return k_ * size_ / count_;
+    }
+
+    // the chunk is read in place through a reader of its own, bounded by the chunk's end, so that each thread decodes
+    // its chunk from the caller's bytes while the calling thread's reader is set aside
+    template<typename I>
+    void _drz_chunk(const Byte data_[], const size_t length_, I first_, size_t count_) noexcept
+    {
+      const _reader input = _input;
+      _input = _reader{data_, data_, data_ + length_};
+
+      decltype(_drz_pointers) pointers;
+      pointers.swap(_drz_pointers);
+
+      for (; count_; --count_, ++first_)
       {
-        return _srz_impl(thing_), _srz();
+        _drz_impl(*first_);
       }
 
-      template<typename type>
-      constexpr
-      _srz operator,(const type& thing_) const &&
+      pointers.swap(_drz_pointers);
+
+      _input = input;
+    }
+
+    template<typename F>
+    void _drz_chunks(const size_t count_, const F& decode_) noexcept
+    {
+#   if defined(_stz_impl_THREADSAFE)
+      if ((_drz_pool != nullptr) and (count_ > 1))
       {
-        return _srz_impl(thing_), _srz();
+        // chunked containers nested in the elements are decoded by the thread reaching them
+        Pool* const pool = _drz_pool;
+        _drz_pool = nullptr;
+
+        pool->run(count_, decode_);
+
+        _drz_pool = pool;
+        return;
       }
+#   endif
 
-      template<typename type>
-      void operator,(const type) const & = delete;
-    };
+      for (size_t k = 0; k < count_; ++k)
+      {
+        decode_(k);
+      }
+    }
 
-    struct _drz
+    // size, chunk count, the byte length of every chunk on 8 bytes, then the chunks
+    template<typename T>
+    void _srz_impl(const Chunked<T>& chunked_) noexcept
     {
-      struct _ver
+      using container_type = typename std::remove_const<T>::type;
+
+      static_assert(_is_chunkable<container_type>::value,
+        "stz: chunked: only std::vector is supported."
+      );
+
+      _stz_impl_IDEBUGGING("chunked %s", _underlying_name<container_type>());
+
+      const auto&  container = *chunked_.container_ptr;
+      const size_t size      = container.size();
+      const size_t count     = std::max<size_t>(1, std::min(size / _chunked_grain, _chunked_chunks));
+
+      _size_t_srz_impl(size);
+      _size_t_srz_impl(count);
+
+      const size_t lengths_front = _buffer.size();
+      _stz_impl_REGROWTH(_buffer.resize(lengths_front + count * sizeof(uint64_t)));
+
+      // pointees are not shared between chunks, each one is decoded on its own
+      decltype(_srz_pointers) pointers;
+      pointers.swap(_srz_pointers);
+
+      for (size_t k = 0; k < count; ++k)
       {
-        template<typename type>
-        void operator=(type _stz_impl_SAFE(version_))
+        const size_t chunk_front = _buffer.size();
+
+        for (size_t j = _chunk_first(k, size, count); j < _chunk_first(k + 1, size, count); ++j)
         {
-          _stz_impl_SAFE(
-          if (version_ >= static_cast<type>(0))
-        ) {
-            _size_t_drz_impl(_version);
-          }
+          _srz_impl(container[j]);
         }
 
-        constexpr bool operator< (const size_t version_) const noexcept { return _version <  version_; }
-        constexpr bool operator<=(const size_t version_) const noexcept { return _version <= version_; }
-        constexpr bool operator> (const size_t version_) const noexcept { return _version >  version_; }
-        constexpr bool operator>=(const size_t version_) const noexcept { return _version >= version_; }
+        _srz_pointers.clear();
 
-      private:
-        size_t _version = static_cast<size_t>(-1);
-      };
+        const uint64_t length = _buffer.size() - chunk_front;
+        std::memcpy(_buffer.data() + lengths_front + k * sizeof(uint64_t), &length, sizeof(uint64_t));
+      }
 
-      void operator<=(_ver) const = delete;
-      void operator, (_ver) const = delete;
+      pointers.swap(_srz_pointers);
+    }
 
-      _ver version;
+    template<typename T>
+    void _drz_impl(Chunked<T>& chunked_) noexcept
+    {
+      static_assert(_is_chunkable<T>::value,
+        "stz: chunked: only std::vector is supported."
+      );
 
-      template<typename type>
-      constexpr
-      _drz operator<=(type& thing_) const &
+      _stz_impl_IDEBUGGING("chunked %s", _underlying_name<T>());
+
+      auto& container = *chunked_.container_ptr;
+
+      size_t size = {};
+      _size_t_drz_impl(size);
+
+      size_t count = {};
+      _size_t_drz_impl(count);
+
+      _stz_impl_SAFE(
+      if _stz_impl_ABNORMAL((count == 0) or (count > _chunked_chunks) or ((_input.left() / sizeof(uint64_t)) < count))
       {
-        return _drz_impl(thing_), _drz();
-      }
+        return;
+      })
 
-      template<typename type>
-      constexpr
-      _drz operator,(type& thing_) const &&
+      // offsets[k] is where chunk k starts, relative to the first one
+      size_t offsets[_chunked_chunks + 1] = {};
+      for (size_t k = 0; k < count; ++k)
       {
-        return _drz_impl(thing_), _drz();
-      }
+        uint64_t length = {};
+        std::memcpy(&length, _input.front + k * sizeof(uint64_t), sizeof(uint64_t));
 
-      template<typename type>
-      void operator<=(const type&) const & = delete;
+        offsets[k + 1] = offsets[k] + static_cast<size_t>(length);
+      }
 
-      template<typename type>
-      void operator,(const type&) const && = delete;
+      _input.front += count * sizeof(uint64_t);
 
-      template<class base, typename ptr>
-      constexpr
-      _drz operator<=(Inheritence<base, ptr>&& thing_) const &
+      _stz_impl_SAFE(
+      for (size_t k = 0; k < count; ++k)
       {
-        return _drz_impl(thing_), _drz();
-      }
+        if _stz_impl_ABNORMAL((offsets[k + 1] < offsets[k]) or (offsets[k + 1] > _input.left()))
+        {
+          return;
+        }
+      })
 
-      template<class base, typename ptr>
-      constexpr
-      _drz operator,(Inheritence<base, ptr>&& thing_) const &&
+      container.resize(size);
+
+      const Byte* const chunks = _input.front;
+
+      _drz_chunks(count, [&](const size_t k_)
       {
-        return _drz_impl(thing_), _drz();
-      }
+        const size_t first = _chunk_first(k_, size, count);
+        const size_t last  = _chunk_first(k_ + 1, size, count);
 
-      template<typename type>
-      void operator,(type) const & = delete;
+        _drz_chunk(chunks + offsets[k_], offsets[k_ + 1] - offsets[k_], container.begin() + static_cast<std::ptrdiff_t>(first), last - first);
+      });
+
+      _input.front += offsets[count];
+    }
+
+    template<typename T>
+    void _srz_impl(const Chunked<T>&& chunked_) noexcept
+    {
+      _srz_impl(chunked_);
+    }
+
+    template<typename T>
+    void _drz_impl(Chunked<T>&& chunked_) noexcept
+    {
+      _drz_impl(chunked_);
+    }
+
+    // how the serialization of a container writes its elements
+    struct _element_layout {}; // one by one
+    struct _raw_layout     {}; // static size, written in one pre-sized block
+    struct _bulk_layout    {}; // contiguous fundamentals, copied as a whole
+
+    // containers parallel_serialize(...) and serialize_async(...) split between elements
+    template<class C>
+    struct _parallel : std::false_type
+    {};
+
+    template<typename T, typename A>
+    struct _parallel<std::vector<T, A>> : std::integral_constant<bool, not (std::is_enum<T>::value and enum_range<T>::value)>
+    {
+      using layout = typename std::conditional<std::is_fundamental<T>::value, _bulk_layout,
+        typename std::conditional<_static_size<T>::value != 0, _raw_layout, _element_layout>::type
+      >::type;
+    };
+
+    template<typename A>
+    struct _parallel<std::vector<bool, A>> : std::false_type
+    {};
+
+    template<typename T, typename A>
+    struct _parallel<std::deque<T, A>> : std::true_type
+    {
+      using layout = typename std::conditional<_static_size<T>::value != 0, _raw_layout, _element_layout>::type;
+    };
+
+    template<typename T, typename A>
+    struct _parallel<std::list<T, A>> : std::true_type
+    {
+      using layout = _element_layout;
     };
 
-    template<typename T>
-    constexpr
-    void _srz_impl(const std::complex<T>& complex_) noexcept
+    template<class C>
+    struct _parallel_associative : _is_node_reusable<C>
     {
-      _stz_impl_IDEBUGGING("std::complex<%s>", _underlying_name<T>());
+      using layout = _element_layout;
+    };
 
-      _srz_impl(complex_.real);
-      _srz_impl(complex_.imag);
-    }
+    template<typename T1, typename T2, class C, class A>
+    struct _parallel<std::map<T1, T2, C, A>> : _parallel_associative<std::map<T1, T2, C, A>> {};
 
-    template<typename T>
-    constexpr
-    void _drz_impl(std::complex<T>& complex_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::complex<%s>", _underlying_name<T>());
+    template<typename T1, typename T2, class C, class A>
+    struct _parallel<std::multimap<T1, T2, C, A>> : _parallel_associative<std::multimap<T1, T2, C, A>> {};
 
-      _drz_impl(complex_.real);
-      _drz_impl(complex_.imag);
-    }
+    template<typename T, class C, class A>
+    struct _parallel<std::set<T, C, A>> : _parallel_associative<std::set<T, C, A>> {};
 
-    template<typename T>
-    constexpr
-    void _srz_impl(const std::atomic<T>& atomic_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::atomic<%s>", _underlying_name<T>());
+    template<typename T, class C, class A>
+    struct _parallel<std::multiset<T, C, A>> : _parallel_associative<std::multiset<T, C, A>> {};
 
-      _srz_impl(static_cast<const T&>(atomic_));
-    }
+    template<typename T1, typename T2, class H, class E, class A>
+    struct _parallel<std::unordered_map<T1, T2, H, E, A>> : _parallel_associative<std::unordered_map<T1, T2, H, E, A>> {};
 
-    template<typename T>
-    constexpr
-    void _drz_impl(std::atomic<T>& atomic_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::atomic<%s>", _underlying_name<T>());
+    template<typename T1, typename T2, class H, class E, class A>
+    struct _parallel<std::unordered_multimap<T1, T2, H, E, A>> : _parallel_associative<std::unordered_multimap<T1, T2, H, E, A>> {};
 
-      T value = {};
-      _drz_impl(value);
-      atomic_ = value;
+    template<typename T, class H, class E, class A>
+    struct _parallel<std::unordered_set<T, H, E, A>> : _parallel_associative<std::unordered_set<T, H, E, A>> {};
+
+    template<typename T, class H, class E, class A>
+    struct _parallel<std::unordered_multiset<T, H, E, A>> : _parallel_associative<std::unordered_multiset<T, H, E, A>> {};
+
+    template<typename I>
+    void _srz_chunk(I first_, size_t length_, _element_layout) noexcept
+    {
+      for (; length_; --length_, ++first_)
+      {
+        _srz_impl(*first_);
+      }
     }
 
-    template<typename T>
-    _stz_impl_CONSTEXPR_CPP14
-    void _srz_impl(const std::basic_string<T>& string_) noexcept
+    template<typename I>
+    void _srz_chunk(I first_, size_t length_, _raw_layout) noexcept
     {
-      _stz_impl_IDEBUGGING("std::basic_string<%s>", _underlying_name<T>());
+      using T = typename std::iterator_traits<I>::value_type;
 
-      _size_t_srz_impl(string_.size());
+      const size_t front = _buffer.size();
+      _stz_impl_REGROWTH(_buffer.resize(front + _static_size<T>::value * length_));
 
-      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
-      {
-        _srz_impl_many_fundamentals(string_[0], string_.size());
-      }
-      else
+      Byte* raw_ptr = _buffer.data() + front;
+      for (; length_; --length_, ++first_)
       {
-        for (const auto character : string_)
-        {
-          _srz_impl(character);
-        }
+        _srz_raw(raw_ptr, *first_);
       }
     }
 
-    template<typename T>
-    _stz_impl_CONSTEXPR_CPP14
-    void _drz_impl(std::basic_string<T>& string_) noexcept
+    template<typename I>
+    void _srz_chunk(I first_, const size_t length_, _bulk_layout) noexcept
     {
-      _stz_impl_IDEBUGGING("std::basic_string<%s>", _underlying_name<T>());
+      _srz_impl_many_fundamentals(*first_, length_);
+    }
 
-      size_t size = {};
-      _size_t_drz_impl(size);
+    template<class C>
+    void _srz_parallel_header(const C& container_, std::true_type) noexcept
+    {
+      _size_t_srz_impl(container_.size());
+      _srz_buckets(container_);
+    }
 
-      string_.resize(size);
+    template<class C>
+    void _srz_parallel_header(const C& container_, std::false_type) noexcept
+    {
+      _size_t_srz_impl(container_.size());
+    }
 
-      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
-      {
-        _drz_impl_many_fundamentals(string_[0], size);
-      }
-      else
+# if defined(__cpp_impl_coroutine)
+    // a serialization that suspends once _buffer holds a window, and is resumed until it is done
+    class _async_steps final
+    {
+    public:
+      struct promise_type
       {
-        for (auto& character : string_)
+        auto get_return_object() noexcept -> _async_steps
         {
-          _drz_impl(character);
+          return _async_steps(std::coroutine_handle<promise_type>::from_promise(*this));
         }
-      }
-    }
 
-    template<typename T, size_t N1>
-    _stz_impl_CONSTEXPR_CPP14
-    void _srz_impl(const std::array<T, N1>& array_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::array<%s, %zu>", _underlying_name<T>(), N1);
+        auto initial_suspend() noexcept -> std::suspend_always { return {}; }
+        auto final_suspend()   noexcept -> std::suspend_always { return {}; }
 
-      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
-      {
-        _srz_impl_many_fundamentals(array_[0], N1);
-      }
-      else
-      {
-        for (const auto& value : array_)
+        void return_void() noexcept {}
+
+        void unhandled_exception() noexcept
         {
-          _srz_impl(value);
+          std::terminate();
         }
-      }
-    }
+      };
 
-    template<typename T, size_t N1>
-    _stz_impl_CONSTEXPR_CPP14
-    void _drz_impl(std::array<T, N1>& array_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::array<%s, %zu>", _underlying_name<T>(), N1);
+      _async_steps(_async_steps&& other_) noexcept :
+        _handle(other_._handle)
+      {
+        other_._handle = nullptr;
+      }
 
-      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
+      ~_async_steps() noexcept
       {
-        _drz_impl_many_fundamentals(array_[0], N1);
+        if (_handle) _handle.destroy();
       }
-      else
+
+      _async_steps(const _async_steps&)            = delete;
+      _async_steps& operator=(const _async_steps&) = delete;
+
+      // serialize up to the next pause, return whether some is left
+      bool resume() noexcept
       {
-        for (auto& value : array_)
-        {
-          _drz_impl(value);
-        }
+        _handle.resume();
+        return not _handle.done();
       }
-    }
+
+    private:
+      std::coroutine_handle<promise_type> _handle;
+
+      explicit _async_steps(const std::coroutine_handle<promise_type> handle_) noexcept :
+        _handle(handle_)
+      {}
+    };
+
+    // what serialize_async(...) pauses within: the containers it splits between elements, and the pairs, tuples,
+    // aggregates, bases and classes with serialization_sequential(...) holding some, field by field, as well as every
+    // class with serialization_procedural(...)
+    template<typename T, typename = void>
+    struct _pausable : std::integral_constant<bool, _parallel<T>::value> {};
+
+    template<typename F>
+    struct _pausable_fields;
+
+    template<typename... F>
+    struct _pausable_fields<std::tuple<F...>> : std::disjunction<_pausable<_bare<F>>...> {};
+
+    template<typename T1, typename T2>
+    struct _pausable<std::pair<T1, T2>> : std::disjunction<_pausable<_bare<T1>>, _pausable<_bare<T2>>> {};
+
+    template<typename... T>
+    struct _pausable<std::tuple<T...>> : _pausable_fields<std::tuple<T...>> {};
 
     template<typename T>
-    _stz_impl_CONSTEXPR_CPP14
-    void _srz_impl(const std::vector<T>& vector_) noexcept
+    struct _pausable<T, std::enable_if_t<std::conjunction_v<_is_reflected<T>, _has_tied_fields<T>>>>
+      : _pausable_fields<decltype(_tie_fields(std::declval<T&>()))> {};
+
+    template<typename base, typename ptr>
+    struct _pausable<Inheritence<base, ptr>> : _pausable<base> {};
+
+    template<typename T>
+    struct _pausable<T, std::enable_if_t<_backdoor::_has_seq<T>()>>
+      : std::bool_constant<_backdoor::_seq_pausable<T>()> {};
+
+    // the fields listed by serialization_sequential(...), by reference, but base_type<...>(this) by value
+    template<typename... T>
+    auto _tie_sequence(T&&... fields_) noexcept -> std::tuple<T...>
     {
-      _stz_impl_IDEBUGGING("std::vector<%s>", _underlying_name<T>());
+      return std::tuple<T...>(std::forward<T>(fields_)...);
+    }
 
-      _size_t_srz_impl(vector_.size());
+    template<typename T>
+    auto _srz_steps(const T& thing_, size_t window_) noexcept -> _async_steps;
 
-      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
-      {
-        _srz_impl_many_fundamentals(vector_[0], vector_.size());
-      }
-      else
+    template<typename T1, typename T2>
+    auto _srz_steps(const std::pair<T1, T2>& pair_, size_t window_) noexcept -> _async_steps;
+
+    template<typename base, typename ptr>
+    auto _srz_steps(const Inheritence<base, ptr>& inheritence_, size_t window_) noexcept -> _async_steps;
+
+    // GCC lowers coroutines to a switch without default, which triggers '-Wswitch-default'
+    _stz_impl_GCC_IGNORE("-Wswitch-default",
+    // fields from the I-th on, the runs of static size written as _srz_tuple(...) does, which pausable fields end
+    template<size_t I, typename... T>
+    auto _srz_tuple_steps(const std::tuple<T...>& tuple_, Byte* raw_ptr_, const size_t window_) noexcept -> _async_steps
+    {
+      if constexpr (I < sizeof...(T))
       {
-        for (const auto& value : vector_)
+        if constexpr (_pausable<_bare<std::tuple_element_t<I, std::tuple<T...>>>>::value)
         {
-          _srz_impl(value);
+          for (auto steps = _srz_steps(std::get<I>(tuple_), window_); steps.resume();)
+          {
+            co_await std::suspend_always();
+          }
+        }
+        else
+        {
+          _srz_tuple_element<I>(tuple_, raw_ptr_);
+        }
+
+        for (auto steps = _srz_tuple_steps<I + 1>(tuple_, raw_ptr_, window_); steps.resume();)
+        {
+          co_await std::suspend_always();
         }
       }
+
+      co_return;
     }
 
-    template<typename T>
-    _stz_impl_CONSTEXPR_CPP14
-    void _drz_impl(std::vector<T>& vector_) noexcept
+    // fields from the I-th on of a serialization_sequential(...)
+    template<size_t I, typename... T>
+    auto _srz_fields_steps(const std::tuple<T...>& fields_, const size_t window_) noexcept -> _async_steps
     {
-      _stz_impl_IDEBUGGING("std::vector<%s>", _underlying_name<T>());
-
-      size_t size = {};
-      _size_t_drz_impl(size);
+      if constexpr (I < sizeof...(T))
+      {
+        using field = std::tuple_element_t<I, std::tuple<T...>>;
 
-      vector_.resize(size);
+        if constexpr (_pausable<_bare<field>>::value)
+        {
+          for (auto steps = _srz_steps(std::get<I>(fields_), window_); steps.resume();)
+          {
+            co_await std::suspend_always();
+          }
+        }
+        else
+        {
+          // inheritences and bitfields only bind as the rvalues they were listed as
+          _srz_impl(static_cast<const field&&>(std::get<I>(fields_)));
+        }
 
-      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
-      {
-        _drz_impl_many_fundamentals(vector_[0], vector_.size());
-      }
-      else
-      {
-        for (auto& value : vector_)
+        for (auto steps = _srz_fields_steps<I + 1>(fields_, window_); steps.resume();)
         {
-          _drz_impl(value);
+          co_await std::suspend_always();
         }
       }
+
+      co_return;
     }
 
-    void _srz_impl(const std::vector<bool>& vector_) noexcept
+    // takes the fields by value, so that they outlive the steps referencing them
+    template<typename... T>
+    auto _srz_sequence_steps(const std::tuple<T...> fields_, const size_t window_) noexcept -> _async_steps
     {
-      _stz_impl_IDEBUGGING("std::vector<bool>");
-
-      _size_t_srz_impl(vector_.size());
-
-      for (const bool value : vector_)
+      for (auto steps = _srz_fields_steps<0>(fields_, window_); steps.resume();)
       {
-        _srz_impl(value);
+        co_await std::suspend_always();
       }
     }
 
-    void _drz_impl(std::vector<bool>& vector_) noexcept
+    template<typename base, typename ptr>
+    auto _srz_steps(const Inheritence<base, ptr>& inheritence_, const size_t window_) noexcept -> _async_steps
     {
-      _stz_impl_IDEBUGGING("std::vector<bool>");
-
-      size_t size = {};
-      _size_t_drz_impl(size);
-
-      vector_.resize(size);
-
-      bool value = {};
-      for (size_t k = 0; k < size; ++k)
+      for (auto steps = _srz_steps(*_backdoor::_const_base(inheritence_), window_); steps.resume();)
       {
-        _drz_impl(value);
-        vector_.push_back(value);
+        co_await std::suspend_always();
       }
     }
 
-    template<typename T>
-    _stz_impl_CONSTEXPR_CPP14
-    void _srz_impl(const std::valarray<T>& valarray_) noexcept
+    template<typename T1, typename T2>
+    auto _srz_steps(const std::pair<T1, T2>& pair_, const size_t window_) noexcept -> _async_steps
     {
-      _stz_impl_IDEBUGGING("std::valarray<%s>", _underlying_name<T>());
-
-      _size_t_srz_impl(valarray_.size());
-
-      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
+      if constexpr (_pausable<_bare<T1>>::value)
       {
-        _srz_impl_many_fundamentals(valarray_[0], valarray_.size());
+        for (auto steps = _srz_steps(pair_.first, window_); steps.resume();)
+        {
+          co_await std::suspend_always();
+        }
       }
       else
       {
-        for (const auto& value : valarray_)
-        {
-          _srz_impl(value);
-        }
+        _srz_impl(pair_.first);
       }
-    }
-
-    template<typename T>
-    _stz_impl_CONSTEXPR_CPP14
-    void _drz_impl(std::valarray<T>& valarray_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::valarray<%s>", _underlying_name<T>());
-
-      size_t size = {};
-      _size_t_drz_impl(size);
-
-      valarray_.resize(size);
 
-      if _stz_impl_CONSTEXPR_CPP17 _stz_impl_EXPECTED(std::is_fundamental<T>::value)
+      if constexpr (_pausable<_bare<T2>>::value)
       {
-        _drz_impl_many_fundamentals(valarray_[0], size);
+        for (auto steps = _srz_steps(pair_.second, window_); steps.resume();)
+        {
+          co_await std::suspend_always();
+        }
       }
       else
       {
-        for (auto& value : valarray_)
-        {
-          _drz_impl(value);
-        }
+        _srz_impl(pair_.second);
       }
     }
 
-    template<size_t N1>
-    _stz_impl_CONSTEXPR_CPP14
-    void _srz_impl(const std::bitset<N1>& bitset_) noexcept
+    template<typename T>
+    auto _srz_steps(const T& thing_, const size_t window_) noexcept -> _async_steps
     {
-      _stz_impl_IDEBUGGING("std::bitset<%zu>", N1);
-
-      _srz_impl(bitset_, 1);
-    }
+      if constexpr (_parallel<T>::value)
+      {
+        using layout = typename _parallel<T>::layout;
+        using value  = typename T::value_type;
 
-    template<size_t N1>
-    _stz_impl_CONSTEXPR_CPP14
-    void _drz_impl(std::bitset<N1>& bitset_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::bitset<%zu>", N1);
+        _srz_parallel_header(thing_, _has_hasher<T>());
 
-      _drz_impl(bitset_, 1);
-    }
+        if constexpr (_pausable<_bare<value>>::value)
+        {
+          for (const auto& element : thing_)
+          {
+            for (auto steps = _srz_steps(element, window_); steps.resume();)
+            {
+              co_await std::suspend_always();
+            }
+
+            if (_buffer.size() >= window_)
+            {
+              co_await std::suspend_always();
+            }
+          }
+        }
+        else
+        {
+          // blocks of static size are sized to fill a window
+          const size_t step = std::is_same<layout, _element_layout>::value ? 1 : std::max<size_t>(1, window_ / sizeof(value));
 
-    template<typename T>
-    constexpr
-    void _srz_impl(const std::list<T>& list_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::list<%s>", _underlying_name<T>());
+          auto iterator = thing_.begin();
+          for (size_t remaining = thing_.size(); remaining;)
+          {
+            const size_t length = std::min(step, remaining);
 
-      _size_t_srz_impl(list_.size());
+            _srz_chunk(iterator, length, layout());
+            std::advance(iterator, static_cast<std::ptrdiff_t>(length));
+            remaining -= length;
 
-      for (const auto& value : list_)
-      {
-        _srz_impl(value);
+            if (_buffer.size() >= window_)
+            {
+              co_await std::suspend_always();
+            }
+          }
+        }
       }
-    }
-
-    template<typename T>
-    constexpr
-    void _drz_impl(std::list<T>& list_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::list<%s>", _underlying_name<T>());
+      else if constexpr (_pausable<T>::value and _backdoor::_has_seq<T>())
+      {
+        _stz_impl_IDEBUGGING("%s", _underlying_name<T>());
 
-      size_t size = {};
-      _size_t_drz_impl(size);
+        for (auto steps = _backdoor::_srz_seq_steps(thing_, window_); steps.resume();)
+        {
+          co_await std::suspend_always();
+        }
+      }
+      else if constexpr (_pausable<T>::value and _is_reflected<T>::value)
+      {
+        const auto fields = _tie_fields(thing_);
 
-      list_.resize(size);
-      for (auto& value : list_)
+        for (auto steps = _srz_tuple_steps<0>(fields, nullptr, window_); steps.resume();)
+        {
+          co_await std::suspend_always();
+        }
+      }
+      else if constexpr (_pausable<T>::value)
       {
-        _drz_impl(value);
+        for (auto steps = _srz_tuple_steps<0>(thing_, nullptr, window_); steps.resume();)
+        {
+          co_await std::suspend_always();
+        }
+      }
+      else
+      {
+        // nothing to pause within, the bytes are cut into windows afterwards
+        _srz_impl(thing_);
       }
+
+      co_return;
     }
+    )
 
-    template<typename T>
-    constexpr
-    void _srz_impl(const std::stack<T>& stack_) noexcept
+    // the serializer of serialization_procedural(...) blocks in serialize_async(...): a block cannot suspend from
+    // within, so it is run again at each resume, skipping what the runs before wrote, up to the member it paused in.
+    // only the members of the object keep their address from one run to the next, other things are written whole
+    class _srz_replayer final
     {
-      _stz_impl_IDEBUGGING("std::stack<%s>", _underlying_name<T>());
+    public:
+      struct _ver : _srz::_ver
+      {
+        explicit _ver(_srz_replayer* const replayer_) noexcept :
+          _replayer(replayer_)
+        {}
+
+        template<typename type>
+        void operator=(const type version_) noexcept
+        {
+          if (_replayer->_due())
+          {
+            if (_set(version_))
+            {
+              _size_t_srz_impl(_version);
+            }
 
-      std::stack<T> temp = stack_;
+            _replayer->_made();
+          }
+        }
 
-      const auto size = stack_.size();
-      _size_t_srz_impl(size);
+      private:
+        _srz_replayer* const _replayer;
+      };
 
-      for (size_t k = size; k; --k)
+      struct _chain
       {
-        _srz_impl(temp.top());
-        temp.pop();
-      }
-    }
+        _srz_replayer& replayer;
 
-    template<typename T>
-    constexpr
-    void _drz_impl(std::stack<T>& stack_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::stack<%s>", _underlying_name<T>());
+        template<typename type>
+        _chain operator,(type&& thing_) && noexcept
+        {
+          replayer._write(std::forward<type>(thing_));
+          return _chain{replayer};
+        }
 
-      size_t size = {};
-      _size_t_drz_impl(size);
+        void operator,(_ver) const = delete;
+      };
 
-      std::stack<T> temp;
+      _ver version{this};
 
-      T value = {};
-      for (size_t k = size; k; --k)
-      {
-        _drz_impl(value);
-        temp.push(std::move(value));
-      }
+      template<typename T>
+      _srz_replayer(const T& thing_, const size_t window_) noexcept :
+        _window(window_),
+        _begin(reinterpret_cast<std::uintptr_t>(&thing_)),
+        _end(reinterpret_cast<std::uintptr_t>(&thing_) + sizeof(T))
+      {}
 
-      stack_ = std::stack<T>();
-      for (size_t k = size; k; --k)
-      {
-        stack_.push(std::move(temp.top()));
-        temp.pop();
-      }
-    }
+      _srz_replayer(const _srz_replayer&)            = delete;
+      _srz_replayer& operator=(const _srz_replayer&) = delete;
 
-    template<typename T>
-    constexpr
-    void _srz_impl(const std::forward_list<T>& forward_list_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::forward_list<%s>", _underlying_name<T>());
+      void operator<=(_ver) const = delete;
 
-      size_t size = 0;
-      for (auto iterator = forward_list_.begin(), end = forward_list_.end(); iterator != end; ++iterator)
+      template<typename type>
+      _chain operator<=(type&& thing_) & noexcept
       {
-        ++size;
+        _write(std::forward<type>(thing_));
+        return _chain{*this};
       }
-      _size_t_srz_impl(size);
 
-      for (const auto& value : forward_list_)
+      // run the block of 'thing_' once more, return whether it paused
+      template<typename T>
+      bool rerun(const T& thing_) noexcept
       {
-        _srz_impl(value);
-      }
-    }
-
-    template<typename T>
-    constexpr
-    void _drz_impl(std::forward_list<T>& forward_list_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::forward_list<%s>", _underlying_name<T>());
+        _index  = 0;
+        _paused = false;
 
-      size_t size = {};
-      _size_t_drz_impl(size);
+        _backdoor::_srz_seq_replay(thing_, *this);
 
-      forward_list_.resize(size);
-      for (auto& value : forward_list_)
-      {
-        _drz_impl(value);
+        return _paused;
       }
-    }
 
-    template<typename T, typename S>
-    constexpr
-    void _srz_impl(const std::queue<T, S>& queue_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::queue<%s>", _underlying_name<T>());
+    private:
+      // the writes met in this run, and those completed over all runs
+      size_t _index = 0;
+      size_t _done  = 0;
+      bool   _paused = false;
 
-      std::queue<T, S> temp = queue_;
+      const size_t         _window;
+      const std::uintptr_t _begin;
+      const std::uintptr_t _end;
 
-      const auto size = queue_.size();
-      _size_t_srz_impl(size);
+      // the member paused in
+      std::optional<_async_steps> _steps;
 
-      for (size_t k = size; k; --k)
+      bool _due() noexcept
       {
-        _srz_impl(temp.front());
-        temp.pop();
+        return (_index++ == _done) and not _paused;
       }
-    }
-
-    template<typename T, typename S>
-    constexpr
-    void _drz_impl(std::queue<T, S>& queue_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::queue<%s>", _underlying_name<T>());
-
-      size_t size = {};
-      _size_t_drz_impl(size);
 
-      queue_ = std::queue<T, S>();
-
-      T value = {};
-      for (size_t k = size; k; --k)
+      void _made() noexcept
       {
-        _drz_impl(value);
-        queue_.push(std::move(value));
+        ++_done;
+        _paused = _buffer.size() >= _window;
       }
-    }
 
-    template<typename T, class C, class F>
-    constexpr
-    void _srz_impl(const std::priority_queue<T, C, F>& priority_queue_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::priority_queue<%s>", _underlying_name<std::priority_queue<T, C, F>>());
+      template<typename type>
+      void _write(type&& thing_) noexcept
+      {
+        if (not _due())
+        {
+          return;
+        }
 
-      std::priority_queue<T, C, F> temp = priority_queue_;
+        if constexpr (_pausable<_bare<type>>::value and std::is_lvalue_reference<type>::value)
+        {
+          const auto address = reinterpret_cast<std::uintptr_t>(std::addressof(thing_));
 
-      const auto size = priority_queue_.size();
+          if (address >= _begin and address < _end)
+          {
+            if (not _steps)
+            {
+              _steps.emplace(_srz_steps(thing_, _window));
+            }
+
+            if (_steps->resume())
+            {
+              _paused = true;
+              return;
+            }
+
+            _steps.reset();
+            return _made();
+          }
+        }
 
-      _size_t_srz_impl(size);
+        _srz_impl(std::forward<type>(thing_));
+        _made();
+      }
 
-      for (size_t k = size; k; --k)
+      template<class base, typename ptr>
+      void _write(Inheritence<base, ptr>&& inheritence_) noexcept
       {
-        _srz_impl(temp.top());
-        temp.pop();
+        _write(*_backdoor::_const_base(inheritence_));
       }
-    }
+    };
 
-    template<typename T, class C, class F>
-    _stz_impl_CONSTEXPR_CPP14
-    void _drz_impl(std::priority_queue<T, C, F>& priority_queue_) noexcept
+    _stz_impl_GCC_IGNORE("-Wswitch-default",
+    template<typename T>
+    auto _srz_procedural_steps(const T& thing_, const size_t window_) noexcept -> _async_steps
     {
-      _stz_impl_IDEBUGGING("std::priority_queue<%s>", _underlying_name<std::priority_queue<T, C, F>>());
-
-      size_t size = 0;
-      _size_t_drz_impl(size);
+      _srz_replayer replayer(thing_, window_);
 
-      priority_queue_ = std::priority_queue<T, C, F>();
-
-      T value = {};
-      for (size_t k = size; k; --k)
+      while (replayer.rerun(thing_))
       {
-        _drz_impl(value);
-        priority_queue_.push(std::move(value));
+        co_await std::suspend_always();
       }
     }
+    )
 
-    template<typename T, typename A>
-    constexpr
-    void _srz_impl(const std::deque<T, A>& deque_) noexcept
+    // the stream's bytes and pointers, lent to the thread's _buffer and _srz_pointers only while producing so that
+    // the caller may serialize other things between two chunks, and resume the stream from another thread
+    struct _async_stream
     {
-      _stz_impl_IDEBUGGING("std::deque<%s>", _underlying_name<T>());
-
-      _size_t_srz_impl(deque_.size());
+      Bytes                   bytes;
+      decltype(_srz_pointers) pointers;
 
-      for (const auto& value : deque_)
+      void swap() noexcept
       {
-        _srz_impl(value);
+        bytes.swap(_buffer);
+        pointers.swap(_srz_pointers);
       }
-    }
+    };
 
-    template<typename T, typename A>
-    constexpr
-    void _drz_impl(std::deque<T, A>& deque_) noexcept
+    _stz_impl_GCC_IGNORE("-Wswitch-default",
+    template<typename T>
+    auto _srz_async(const T& thing_, const size_t window_) noexcept -> Chunks
     {
-      _stz_impl_IDEBUGGING("std::deque<%s>", _underlying_name<T>());
-
-      size_t size = {};
-      _size_t_drz_impl(size);
+      _async_steps  steps = _srz_steps(thing_, window_);
+      _async_stream stream;
+      Bytes         chunk;
 
-      deque_.resize(size);
-      for (auto& value : deque_)
+      for (bool more = true; more;)
       {
-        _drz_impl(value);
+        stream.swap();
+        more = steps.resume();
+        stream.swap();
+
+        // the last window is yielded even if not full
+        size_t front = 0;
+        while (((stream.bytes.size() - front) >= window_) or ((not more) and (front < stream.bytes.size())))
+        {
+          const size_t length = std::min(window_, stream.bytes.size() - front);
+          chunk.assign(stream.bytes.data() + front, stream.bytes.data() + front + length);
+          front += length;
+
+          co_yield static_cast<const Bytes&>(chunk);
+        }
+
+        stream.bytes.erase(stream.bytes.begin(), stream.bytes.begin() + static_cast<std::ptrdiff_t>(front));
       }
     }
+    )
+# endif
 
-    template<typename T1, typename T2>
-    constexpr
-    void _srz_impl(const std::pair<T1, T2>& pair_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::pair<%s, %s>", _underlying_name<T1>(), _underlying_name<T2>());
+# if defined(_stz_impl_THREADSAFE)
+    // fewest elements per chunk, below that the chunk is not worth a thread
+    constexpr size_t _parallel_grain = 1024;
 
-      _srz_impl(pair_.first);
-      _srz_impl(pair_.second);
-    }
+    // objects per task of serialize_batch(...), threads done early take the next task
+    constexpr size_t _batch_grain = 16;
 
-    template<typename T1, typename T2>
-    constexpr
-    void _drz_impl(std::pair<T1, T2>& pair_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::pair<%s, %s>", _underlying_name<T1>(), _underlying_name<T2>());
+    // chunks per thread, so that threads finishing early pick up more work
+    constexpr size_t _parallel_chunks_per_thread = 4;
 
-      _drz_impl(pair_.first);
-      _drz_impl(pair_.second);
+    template<typename T>
+    auto _parallel_srz(Pool&, const T& thing_, std::false_type) noexcept -> Bytes
+    {
+      return serialize(thing_);
     }
 
-    template<typename T1, typename T2>
-    constexpr
-    void _srz_impl(const std::unordered_map<T1, T2>& unordered_map_) noexcept
+    template<typename T>
+    auto _parallel_srz(Pool& pool_, const T& container_, std::true_type) noexcept -> Bytes
     {
-      _stz_impl_IDEBUGGING("std::unordered_map");
-
-      _size_t_srz_impl(unordered_map_.size());
+      const size_t size  = container_.size();
+      const size_t count = std::min(size / _parallel_grain, pool_.size() * _parallel_chunks_per_thread);
 
-      for (const auto& key_value : unordered_map_)
+      if (count < 2)
       {
-        _srz_impl(key_value);
+        return serialize(container_);
       }
-    }
-
-    template<typename T1, typename T2>
-    constexpr
-    void _drz_impl(std::unordered_map<T1, T2>& unordered_map_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::unordered_map");
 
-      size_t size = {};
-      _size_t_drz_impl(size);
+      _stz_impl_IDEBUGGING("serialization summary: %zu chunks", count);
 
-      unordered_map_.clear();
-      unordered_map_.reserve(size);
+      // chunk k holds the elements [k*size/count, (k + 1)*size/count)
+      std::vector<typename T::const_iterator> firsts;
+      firsts.reserve(count);
 
-      std::pair<T1, T2> key_value = {};
-      for (size_t k = 0; k < size; ++k)
+      auto iterator = container_.begin();
+      for (size_t k = 0, position = 0; k < count; ++k)
       {
-        _drz_impl(key_value);
-        unordered_map_.insert(std::move(key_value));
+        const size_t first = k * size / count;
+        std::advance(iterator, static_cast<std::ptrdiff_t>(first - position));
+        position = first;
+
+        firsts.push_back(iterator);
       }
-    }
 
-    template<typename T1, typename T2>
-    constexpr
-    void _srz_impl(const std::unordered_multimap<T1, T2>& unordered_multimap_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::unordered_multimap");
+      // each thread serializes into its own _buffer, lent to the chunk for the time of the task
+      std::vector<Bytes> chunks(count);
+      std::atomic<bool>  pointees = {false};
+      pool_.run(count, [&](const size_t k_)
+      {
+        const size_t length = (k_ + 1) * size / count - k_ * size / count;
 
-      _size_t_srz_impl(unordered_multimap_.size());
+        _buffer.swap(chunks[k_]);
+        _buffer.clear();
+        _buffer.reserve(length * sizeof(typename T::value_type));
 
-      for (const auto& key_value : unordered_multimap_)
-      {
-        _srz_impl(key_value);
-      }
-    }
+        _srz_chunk(firsts[k_], length, typename _parallel<T>::layout());
 
-    template<typename T1, typename T2>
-    constexpr
-    void _drz_impl(std::unordered_multimap<T1, T2>& unordered_multimap_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::unordered_multimap");
+        if (_srz_pointer_count() != 0)
+        {
+          pointees.store(true, std::memory_order_relaxed);
+        }
 
-      size_t size = {};
-      _size_t_drz_impl(size);
+        _clear_pointers();
 
-      unordered_multimap_.clear();
-      unordered_multimap_.reserve(size);
+        _buffer.swap(chunks[k_]);
+      });
 
-      std::pair<T1, T2> key_value = {};
-      for (size_t k = 0; k < size; ++k)
+      // a pointee is written in full where it is first met, which the chunks cannot know of one another
+      if (pointees.load(std::memory_order_relaxed))
       {
-        _drz_impl(key_value);
-        unordered_multimap_.insert(std::move(key_value));
+        return serialize(container_);
       }
-    }
-
-    template<typename T1, typename T2>
-    constexpr
-    void _srz_impl(const std::map<T1, T2>& map_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::map");
 
-      _size_t_srz_impl(map_.size());
+      _buffer.clear();
+      _srz_parallel_header(container_, _has_hasher<T>());
 
-      for (const auto& key_value : map_)
+      // prefix sum of the chunk sizes gives where each chunk lands
+      std::vector<size_t> offsets(count + 1);
+      offsets[0] = _buffer.size();
+      for (size_t k = 0; k < count; ++k)
       {
-        _srz_impl(key_value);
+        offsets[k + 1] = offsets[k] + chunks[k].size();
       }
+
+      Bytes bytes(offsets[count]);
+      std::memcpy(bytes.data(), _buffer.data(), offsets[0]);
+      _stz_impl_STATS(_count_returned(bytes));
+
+      pool_.run(count, [&](const size_t k_)
+      {
+        std::memcpy(bytes.data() + offsets[k_], chunks[k_].data(), chunks[k_].size());
+      });
+
+      return bytes;
     }
 
-    template<typename T1, typename T2>
-    constexpr
-    void _drz_impl(std::map<T1, T2>& map_) noexcept
+    // bounded single-producer single-consumer ring, the producer blocks while it is full and the consumer while it is
+    // empty; they never wait at the same time
+    template<typename T, size_t N>
+    class _spsc_queue final
     {
-      _stz_impl_IDEBUGGING("std::map");
+    public:
+      void push(T value_) noexcept
+      {
+        std::unique_lock<std::mutex> lock{_mtx};
+        _changed.wait(lock, [this]{ return (_tail - _head) != N; });
 
-      size_t size = {};
-      _size_t_drz_impl(size);
+        _slots[_tail % N] = std::move(value_);
+        ++_tail;
 
-      map_.clear();
+        lock.unlock();
+        _changed.notify_one();
+      }
 
-      std::pair<T1, T2> key_value = {};
-      for (size_t k = 0; k < size; ++k)
+      auto pop() noexcept -> T
       {
-        _drz_impl(key_value);
-        map_.insert(std::move(key_value));
-      }
-    }
+        std::unique_lock<std::mutex> lock{_mtx};
+        _changed.wait(lock, [this]{ return _tail != _head; });
 
-    template<typename T1, typename T2>
-    constexpr
-    void _srz_impl(const std::multimap<T1, T2>& multimap_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::multimap");
+        T value = std::move(_slots[_head % N]);
+        ++_head;
 
-      _size_t_srz_impl(multimap_.size());
+        lock.unlock();
+        _changed.notify_one();
 
-      for (const auto& key_value : multimap_)
-      {
-        _srz_impl(key_value);
+        return value;
       }
-    }
 
-    template<typename T1, typename T2>
-    constexpr
-    void _drz_impl(std::multimap<T1, T2>& multimap_) noexcept
+    private:
+      std::mutex              _mtx;
+      std::condition_variable _changed;
+      size_t                  _head    = 0;
+      size_t                  _tail    = 0;
+      T                       _slots[N] = {};
+    };
+
+    // chunk N + 1 being serialized, chunk N being transformed, chunk N - 1 being sunk and one to spare
+    constexpr size_t _pipeline_depth = 4;
+
+    struct _pipeline
     {
-      _stz_impl_IDEBUGGING("std::multimap");
+      _spsc_queue<Bytes*, _pipeline_depth> free;        // sink to serializer, recycled chunks
+      _spsc_queue<Bytes*, _pipeline_depth> serialized;  // serializer to transform
+      _spsc_queue<Bytes*, _pipeline_depth> transformed; // transform to sink
+      size_t                               chunk_size;
 
-      size_t size = {};
-      _size_t_drz_impl(size);
+      // the full _buffer is handed off, _buffer keeps serializing into the storage of a recycled chunk
+      void flush() noexcept
+      {
+        Bytes* const chunk = free.pop();
 
-      multimap_.clear();
+        chunk->swap(_buffer);
+        _buffer.clear();
+
+        serialized.push(chunk);
+      }
 
-      std::pair<T1, T2> key_value = {};
-      for (size_t k = 0; k < size; ++k)
+      void flush_if_full() noexcept
       {
-        _drz_impl(key_value);
-        multimap_.insert(std::move(key_value));
+        if (_buffer.size() >= chunk_size)
+        {
+          flush();
+        }
       }
-    }
+    };
 
+    // no elements to cut between, the bytes are handed off whole as a single chunk rather than copied out piece by piece
     template<typename T>
-    constexpr
-    void _srz_impl(const std::unordered_set<T>& unordered_set_) noexcept
+    void _srz_pipelined(_pipeline& pipeline_, const T& thing_, std::false_type) noexcept
     {
-      _stz_impl_IDEBUGGING("std::unordered_set");
+      _srz_impl(thing_);
 
-      _size_t_srz_impl(unordered_set_.size());
-
-      for (const auto& key : unordered_set_)
+      if (not _buffer.empty())
       {
-        _srz_impl(key);
+        pipeline_.flush();
       }
     }
 
     template<typename T>
-    constexpr
-    void _drz_impl(std::unordered_set<T>& unordered_set_) noexcept
+    void _srz_pipelined(_pipeline& pipeline_, const T& container_, std::true_type) noexcept
     {
-      _stz_impl_IDEBUGGING("std::unordered_set");
+      using layout = typename _parallel<T>::layout;
+      using value  = typename T::value_type;
 
-      size_t size = {};
-      _size_t_drz_impl(size);
+      _srz_parallel_header(container_, _has_hasher<T>());
 
-      unordered_set_.clear();
-      unordered_set_.reserve(size);
+      // elements written one by one are checked one by one, blocks of static size are sized to fill a chunk
+      const size_t step = std::is_same<layout, _element_layout>::value ? 1
+        : std::max<size_t>(1, pipeline_.chunk_size / sizeof(value));
 
-      T key = {};
-      for (size_t k = 0; k < size; ++k)
+      auto iterator = container_.begin();
+      for (size_t remaining = container_.size(); remaining;)
       {
-        _drz_impl(key);
-        unordered_set_.insert(std::move(key));
-      }
-    }
+        const size_t length = std::min(step, remaining);
 
-    template<typename T>
-    constexpr
-    void _srz_impl(const std::unordered_multiset<T>& unordered_multiset_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::unordered_multiset");
+        _srz_chunk(iterator, length, layout());
+        std::advance(iterator, static_cast<std::ptrdiff_t>(length));
+        remaining -= length;
 
-      _size_t_srz_impl(unordered_multiset_.size());
+        pipeline_.flush_if_full();
+      }
 
-      for (const auto& key : unordered_multiset_)
+      if (not _buffer.empty())
       {
-        _srz_impl(key);
+        pipeline_.flush();
       }
     }
 
-    template<typename T>
-    constexpr
-    void _drz_impl(std::unordered_multiset<T>& unordered_multiset_) noexcept
+    template<typename T, typename F1, typename F2>
+    void _serialize_pipelined(const T& thing_, F1& transform_, F2& sink_, const size_t chunk_size_) noexcept
     {
-      _stz_impl_IDEBUGGING("std::unordered_multiset");
+      _stz_impl_IDEBUGGING("serialization summary: pipelined in chunks of %zu bytes", chunk_size_);
 
-      size_t size = {};
-      _size_t_drz_impl(size);
+      _pipeline pipeline;
+      pipeline.chunk_size = std::max<size_t>(1, chunk_size_);
 
-      unordered_multiset_.clear();
-      unordered_multiset_.reserve(size);
-
-      T key = {};
-      for (size_t k = 0; k < size; ++k)
+      Bytes chunks[_pipeline_depth];
+      for (auto& chunk : chunks)
       {
-        _drz_impl(key);
-        unordered_multiset_.insert(std::move(key));
+        pipeline.free.push(&chunk);
       }
-    }
 
-    template<typename T>
-    constexpr
-    void _srz_impl(const std::set<T>& set_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::set");
+      // nullptr marks the end of the stream
+      std::thread transformer([&]
+      {
+        for (Bytes* chunk; (chunk = pipeline.serialized.pop()) != nullptr;)
+        {
+          transform_(*chunk);
+          pipeline.transformed.push(chunk);
+        }
 
-      _size_t_srz_impl(set_.size());
+        pipeline.transformed.push(nullptr);
+      });
 
-      for (const auto& key : set_)
+      std::thread sinker([&]
       {
-        _srz_impl(key);
-      }
-    }
-
-    template<typename T>
-    constexpr
-    void _drz_impl(std::set<T>& set_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::set");
+        for (Bytes* chunk; (chunk = pipeline.transformed.pop()) != nullptr;)
+        {
+          sink_(static_cast<const Bytes&>(*chunk));
+          pipeline.free.push(chunk);
+        }
+      });
 
-      size_t size = {};
-      _size_t_drz_impl(size);
+      _buffer.clear();
+      _srz_pipelined(pipeline, thing_, _parallel<T>());
+      _clear_pointers();
 
-      set_.clear();
+      pipeline.serialized.push(nullptr);
 
-      T key = {};
-      for (size_t k = 0; k < size; ++k)
-      {
-        _drz_impl(key);
-        set_.insert(std::move(key));
-      }
+      transformer.join();
+      sinker.join();
     }
 
-    template<typename T>
-    constexpr
-    void _srz_impl(const std::multiset<T>& multiset_) noexcept
+    template<typename I>
+    void _srz_batch(Pool& pool_, I first_, const size_t size_, Batch& batch_) noexcept
     {
-      _stz_impl_IDEBUGGING("std::multiset");
+      const size_t count = (size_ + _batch_grain - 1) / _batch_grain;
 
-      _size_t_srz_impl(multiset_.size());
+      _stz_impl_IDEBUGGING("serialization summary: batch of %zu in %zu tasks", size_, count);
 
-      for (const auto& key : multiset_)
+      batch_.spans.resize(size_);
+
+      if (batch_.slabs.size() < count)
       {
-        _srz_impl(key);
+        batch_.slabs.resize(count);
       }
-    }
 
-    template<typename T>
-    constexpr
-    void _drz_impl(std::multiset<T>& multiset_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::multiset");
+      // Batch is not bound to an iterator type, the first iterator of every task is kept per thread instead, and lent
+      // to the workers by reference
+      static _stz_impl_THREADLOCAL std::vector<I> kept_firsts;
+      std::vector<I>& firsts = kept_firsts;
+      firsts.clear();
 
-      size_t size = {};
-      _size_t_drz_impl(size);
+      for (size_t k = 0; k < count; ++k)
+      {
+        firsts.push_back(first_);
 
-      multiset_.clear();
+        if ((k + 1) < count)
+        {
+          std::advance(first_, static_cast<std::ptrdiff_t>(_batch_grain));
+        }
+      }
 
-      T key = {};
-      for (size_t k = 0; k < size; ++k)
+      // the first batch is sized as if the objects were written as they lie in memory
+      using value = _bare<typename std::iterator_traits<I>::value_type>;
+      const size_t expected = size_ * ((_static_size<value>::value != 0) ? _static_size<value>::value : sizeof(value));
+
+      if (batch_.arena.size() < expected)
       {
-        _drz_impl(key);
-        multiset_.insert(std::move(key));
+        batch_.arena.resize(expected);
       }
-    }
 
-    template<size_t N1, typename... T>
-    struct _tuple_srz
-    {
-      static inline constexpr
-      void _implementation(const std::tuple<T...>& tuple) noexcept;
-    };
+      // each task serializes through the thread's own _buffer, then claims where its slab lands in the arena
+      std::atomic<size_t> claimed = {0};
+      std::atomic<bool>   overflow = {false};
+      pool_.run(count, [&](const size_t k_)
+      {
+        _buffer.clear();
 
-    template<typename... T>
-    struct _tuple_srz<0, T...>
-    {
-      static inline constexpr
-      void _implementation(const std::tuple<T...>&) noexcept {}
-    };
+        const size_t first = k_ * _batch_grain;
+        const size_t last  = std::min(size_, first + _batch_grain);
 
-    template<size_t N, typename... T>
-    constexpr
-    void _tuple_srz<N, T...>::_implementation(const std::tuple<T...>& tuple_) noexcept
-    {
-      _srz_impl(std::get<sizeof...(T) - N>(tuple_));
-      _tuple_srz<N-1, T...>::_implementation(tuple_);
-    }
+        I iterator = firsts[k_];
+        for (size_t j = first; j < last; ++j, ++iterator)
+        {
+          const size_t front = _buffer.size();
 
-    template<typename... T>
-    constexpr
-    void _srz_impl(const std::tuple<T...>& tuple_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::tuple");
+          _srz_impl(*iterator);
+          _clear_pointers();
 
-      _tuple_srz<sizeof...(T), T...>::_implementation(tuple_);
-    }
+          batch_.spans[j] = {front, _buffer.size() - front};
+        }
 
-    template<size_t N1, typename... T>
-    struct _tuple_drz
-    {
-      static inline constexpr
-      void _implementation(std::tuple<T...>& tuple) noexcept;
-    };
+        const size_t slab = claimed.fetch_add(_buffer.size(), std::memory_order_relaxed);
 
-    template<typename... T>
-    struct _tuple_drz<0, T...>
-    {
-      static inline constexpr
-      void _implementation(std::tuple<T...>&) noexcept {}
-    };
+        for (size_t j = first; j < last; ++j)
+        {
+          batch_.spans[j].first += slab;
+        }
 
-    template<size_t N, typename... T>
-    constexpr
-    void _tuple_drz<N, T...>::_implementation(std::tuple<T...>& tuple_) noexcept
-    {
-      _drz_impl(std::get<sizeof...(T) - N>(tuple_));
-      _tuple_drz<N-1, T...>::_implementation(tuple_);
-    }
+        if ((slab + _buffer.size()) <= batch_.arena.size())
+        {
+          if (not _buffer.empty())
+          {
+            std::memcpy(batch_.arena.data() + slab, _buffer.data(), _buffer.size());
+          }
 
-    template<typename... T>
-    constexpr
-    void _drz_impl(std::tuple<T...>& tuple_) noexcept
-    {
-      _stz_impl_IDEBUGGING("std::tuple");
+          batch_.slabs[k_].clear();
+        }
+        else
+        {
+          batch_.slabs[k_].swap(_buffer);
+          overflow.store(true, std::memory_order_relaxed);
+        }
+      });
+
+      batch_.used = claimed.load(std::memory_order_relaxed);
 
-      _tuple_drz<sizeof...(T), T...>::_implementation(tuple_);
+      // the slabs that did not fit land past what the arena held, once it is grown with room for slightly larger batches
+      if (overflow.load(std::memory_order_relaxed))
+      {
+        batch_.arena.resize(batch_.used + batch_.used / 4);
+
+        pool_.run(count, [&](const size_t k_)
+        {
+          const Bytes& slab = batch_.slabs[k_];
+
+          if (not slab.empty())
+          {
+            std::memcpy(batch_.arena.data() + batch_.spans[k_ * _batch_grain].first, slab.data(), slab.size());
+          }
+        });
+      }
     }
+# endif
   }
+//*///------------------------------------------------------------------------------------------------------------------
+  template<typename type>
+  struct static_size : std::integral_constant<size_t, _seiriakos_impl::_static_size<_seiriakos_impl::_bare<type>>::value>
+  {};
 //*///------------------------------------------------------------------------------------------------------------------
   template<typename... T>
   _stz_impl_NODISCARD_REASON("serialize: ignoring the return value makes no sens.")
   auto serialize(const T&... things_) noexcept -> Bytes
   {
-    _stz_impl_IDEBUGGING("serialization summary:");
-
     _seiriakos_impl::_buffer.clear();
-    _seiriakos_impl::_buffer.reserve(_seiriakos_impl::_sizeof_many<T...>());
+    _stz_impl_REGROWTH(_seiriakos_impl::_buffer.reserve(_seiriakos_impl::_sizeof_many<T...>()));
+
+    _stz_impl_IDEBUGGING("serialization summary:");
 
     _seiriakos_impl::_srz_dispatch(things_...);
+    _seiriakos_impl::_clear_pointers();
+
+    _stz_impl_STATS(++_seiriakos_impl::_stats.serialize_calls);
+    _stz_impl_STATS(_seiriakos_impl::_stats.bytes_written += _seiriakos_impl::_buffer.size());
+    _stz_impl_STATS(_seiriakos_impl::_count_returned(_seiriakos_impl::_buffer));
 
     return _seiriakos_impl::_buffer;
   }
@@ -1984,12 +6599,16 @@ inline namespace seiriakos
   template<typename... T>
   void deserialize(const Byte data_[], const size_t size_, T&... things_) noexcept
   {
-    _stz_impl_IDEBUGGING("deserialization summary:");
+    // read in place, the bytes are not copied first
+    _seiriakos_impl::_input = _seiriakos_impl::_reader{data_, data_, data_ + size_};
 
-    _seiriakos_impl::_buffer.assign(data_, data_ + size_);
-    _seiriakos_impl::_buffer_front = 0;
+    _stz_impl_IDEBUGGING("deserialization summary:");
 
     _seiriakos_impl::_drz_dispatch(things_...);
+    _seiriakos_impl::_clear_pointers();
+
+    _stz_impl_STATS(++_seiriakos_impl::_stats.deserialize_calls);
+    _stz_impl_STATS(_seiriakos_impl::_stats.bytes_read += _seiriakos_impl::_input.offset());
   }
 //*///------------------------------------------------------------------------------------------------------------------
   template<typename type>
@@ -2003,6 +6622,75 @@ inline namespace seiriakos
     return thing;
   }
 //*///------------------------------------------------------------------------------------------------------------------
+# if defined(_stz_impl_THREADSAFE)
+  template<typename type>
+  auto parallel_serialize(Pool& pool_, const type& thing_) noexcept -> Bytes
+  {
+    return _seiriakos_impl::_parallel_srz(pool_, thing_, _seiriakos_impl::_parallel<type>());
+  }
+# endif
+//*///------------------------------------------------------------------------------------------------------------------
+  template<typename type>
+  void deserialize(const Byte data_[], const size_t size_, NodeReuse<type>&& node_reuse_) noexcept
+  {
+    deserialize(data_, size_, node_reuse_);
+  }
+//*///------------------------------------------------------------------------------------------------------------------
+  template<typename type>
+  void deserialize(const Byte data_[], const size_t size_, Chunked<type>&& chunked_) noexcept
+  {
+    deserialize(data_, size_, chunked_);
+  }
+//*///------------------------------------------------------------------------------------------------------------------
+# if defined(_stz_impl_THREADSAFE)
+  template<typename... type>
+  void parallel_deserialize(Pool& pool_, const Byte data_[], const size_t size_, type&&... things_) noexcept
+  {
+    _seiriakos_impl::_drz_pool = &pool_;
+
+    deserialize(data_, size_, things_...);
+
+    _seiriakos_impl::_drz_pool = nullptr;
+  }
+//*///------------------------------------------------------------------------------------------------------------------
+  template<typename iterator>
+  void serialize_batch(Pool& pool_, const iterator first_, const iterator last_, Batch& batch_) noexcept
+  {
+    _seiriakos_impl::_srz_batch(pool_, first_, static_cast<size_t>(std::distance(first_, last_)), batch_);
+  }
+//*///------------------------------------------------------------------------------------------------------------------
+  template<typename type, typename transform_type, typename sink_type>
+  void serialize_pipelined(const type& thing_, transform_type&& transform_, sink_type&& sink_, const size_t chunk_size_) noexcept
+  {
+    _seiriakos_impl::_serialize_pipelined(thing_, transform_, sink_, chunk_size_);
+  }
+# endif
+//*///------------------------------------------------------------------------------------------------------------------
+  template<typename type>
+  auto serialize_async(const type& thing_, const size_t window_) noexcept -> Chunks
+  {
+#   if defined(__cpp_impl_coroutine)
+    return _seiriakos_impl::_srz_async(thing_, std::max<size_t>(1, window_));
+#   else
+    return Chunks(serialize(thing_), std::max<size_t>(1, window_));
+#   endif
+  }
+//*///------------------------------------------------------------------------------------------------------------------
+# if __cplusplus >= 201703L
+  template<typename type>
+  _stz_impl_NODISCARD_REASON("deserialize: ignoring the return value makes no sens.")
+  type deserialize(const Byte data_[], const size_t size_, std::pmr::memory_resource* const resource_) noexcept
+  {
+    using allocator = std::pmr::polymorphic_allocator<Byte>;
+
+    type thing = _seiriakos_impl::_allocated<type, allocator>::_make(allocator(resource_));
+
+    deserialize(data_, size_, thing);
+
+    return thing;
+  }
+# endif
+//*///------------------------------------------------------------------------------------------------------------------
 # undef  serialization_methods
     constexpr int serialization_methods() noexcept { return 0; }
 # define serialization_methods()                                           \
@@ -2015,6 +6703,21 @@ inline namespace seiriakos
       return stz::deserialize(data_, size_, *this);                        \
     }
 //*///------------------------------------------------------------------------------------------------------------------
+# undef  STZ_MAKE_POLYMORPHIC
+    constexpr int STZ_MAKE_POLYMORPHIC() noexcept { return 0; }
+# define STZ_MAKE_POLYMORPHIC(BASE, ...)                                           \
+    namespace stz                                                                  \
+    {                                                                              \
+      inline namespace seiriakos                                                   \
+      {                                                                            \
+        namespace _seiriakos_impl                                                  \
+        {                                                                          \
+          template<>                                                               \
+          struct _polymorphic<BASE> : _polymorphic_registry<BASE, __VA_ARGS__> {}; \
+        }                                                                          \
+      }                                                                            \
+    }
+//*///------------------------------------------------------------------------------------------------------------------
 /*
 # undef  serialization_sequence
     constexpr int serialization_sequence() noexcept { return 0; }
@@ -2048,40 +6751,130 @@ inline namespace seiriakos
       void _stz_impl_drz_seq() noexcept                   \
       {                                                   \
         stz::_seiriakos_impl::_drz_dispatch(__VA_ARGS__); \
-      }
+      }                                                   \
+      struct _stz_impl_seq_size                           \
+      {                                                   \
+        constexpr std::size_t operator()() const noexcept \
+        {                                                 \
+          return 0;                                       \
+        }                                                 \
+      };
+//*///------------------------------------------------------------------------------------------------------------------
+# if defined(__cpp_impl_coroutine)
+#   define _stz_impl_SEQUENTIAL_STEPS(...)                                        \
+      auto _stz_impl_srz_steps(const std::size_t _stz_impl_window) const noexcept \
+        -> stz::_seiriakos_impl::_async_steps                                     \
+      {                                                                           \
+        return stz::_seiriakos_impl::_srz_sequence_steps(                         \
+          stz::_seiriakos_impl::_tie_sequence(__VA_ARGS__), _stz_impl_window);    \
+      }                                                                           \
+      struct _stz_impl_seq_pausable                                               \
+      {                                                                           \
+        constexpr bool operator()() const noexcept                                \
+        {                                                                         \
+          return stz::_seiriakos_impl::_pausable_fields<                          \
+            decltype(stz::_seiriakos_impl::_tie_sequence(__VA_ARGS__))>::value;   \
+        }                                                                         \
+      };
+#   define _stz_impl_PROCEDURAL_STEPS(...)                                                     \
+      void _stz_impl_srz_replay(                                                               \
+        _stz_impl_MAYBE_UNUSED stz::_seiriakos_impl::_srz_replayer& serializer) const noexcept \
+      {                                                                                        \
+        __VA_ARGS__                                                                            \
+      }                                                                                        \
+      auto _stz_impl_srz_steps(const std::size_t _stz_impl_window) const noexcept              \
+        -> stz::_seiriakos_impl::_async_steps                                                  \
+      {                                                                                        \
+        return stz::_seiriakos_impl::_srz_procedural_steps(*this, _stz_impl_window);           \
+      }                                                                                        \
+      struct _stz_impl_seq_pausable                                                            \
+      {                                                                                        \
+        constexpr bool operator()() const noexcept                                             \
+        {                                                                                      \
+          return true;                                                                         \
+        }                                                                                      \
+      };
+# else
+#   define _stz_impl_SEQUENTIAL_STEPS(...)
+#   define _stz_impl_PROCEDURAL_STEPS(...)
+# endif
 //*///------------------------------------------------------------------------------------------------------------------
 # undef serialization_sequential
     constexpr int serialization_sequential() noexcept { return 0; }
-# define serialization_sequential(...)                    \
-      _seiriakos_impl::_backdoor friend;                  \
-    private:                                              \
-      void _stz_impl_srz_seq() const noexcept             \
-      {                                                   \
-        _stz_impl_assert_trivial(#__VA_ARGS__);           \
-        stz::_seiriakos_impl::_srz_dispatch(__VA_ARGS__); \
-      }                                                   \
-      void _stz_impl_drz_seq() noexcept                   \
-      {                                                   \
-        stz::_seiriakos_impl::_drz_dispatch(__VA_ARGS__); \
-      }
+# define serialization_sequential(...)                                         \
+      _seiriakos_impl::_backdoor friend;                                       \
+    private:                                                                   \
+      void _stz_impl_srz_seq() const noexcept                                  \
+      {                                                                        \
+        _stz_impl_assert_trivial(#__VA_ARGS__);                                \
+        stz::_seiriakos_impl::_srz_dispatch(__VA_ARGS__);                      \
+      }                                                                        \
+      void _stz_impl_drz_seq() noexcept                                        \
+      {                                                                        \
+        stz::_seiriakos_impl::_drz_dispatch(__VA_ARGS__);                      \
+      }                                                                        \
+      struct _stz_impl_seq_size                                                \
+      {                                                                        \
+        constexpr std::size_t operator()() const noexcept                      \
+        {                                                                      \
+          return decltype(stz::_seiriakos_impl::_static_size_of(__VA_ARGS__))::value; \
+        }                                                                      \
+      };                                                                       \
+      void _stz_impl_srz_raw(stz::Byte*& _stz_impl_raw_ptr) const noexcept     \
+      {                                                                        \
+        stz::_seiriakos_impl::_srz_raw_dispatch(_stz_impl_raw_ptr, __VA_ARGS__); \
+      }                                                                        \
+      void _stz_impl_drz_raw(const stz::Byte*& _stz_impl_raw_ptr) noexcept     \
+      {                                                                        \
+        stz::_seiriakos_impl::_drz_raw_dispatch(_stz_impl_raw_ptr, __VA_ARGS__); \
+      }                                                                        \
+      _stz_impl_SEQUENTIAL_STEPS(__VA_ARGS__)
 //*///------------------------------------------------------------------------------------------------------------------
 # undef  serialization_procedural
     constexpr int serialization_procedural() noexcept { return 0; }
-# define serialization_procedural(...)         \
-      _seiriakos_impl::_backdoor friend;       \
-    private:                                   \
-      void _stz_impl_srz_seq() const noexcept  \
-      {                                        \
-        _stz_impl_MAYBE_UNUSED                 \
-        stz::_seiriakos_impl::_srz serializer; \
-        __VA_ARGS__                            \
-      }                                        \
-      void _stz_impl_drz_seq() noexcept        \
-      {                                        \
-        _stz_impl_MAYBE_UNUSED                 \
-        stz::_seiriakos_impl::_drz serializer; \
-        __VA_ARGS__                            \
-      }
+# define serialization_procedural(...)                                 \
+      _seiriakos_impl::_backdoor friend;                               \
+    private:                                                           \
+      void _stz_impl_srz_seq() const noexcept                          \
+      {                                                                \
+        _stz_impl_MAYBE_UNUSED                                         \
+        stz::_seiriakos_impl::_srz serializer;                         \
+        __VA_ARGS__                                                    \
+      }                                                                \
+      void _stz_impl_drz_seq() noexcept                                \
+      {                                                                \
+        _stz_impl_MAYBE_UNUSED                                         \
+        stz::_seiriakos_impl::_drz serializer;                         \
+        __VA_ARGS__                                                    \
+      }                                                                \
+      struct _stz_impl_seq_size                                        \
+      {                                                                \
+        constexpr std::size_t operator()() const noexcept              \
+        {                                                              \
+          return 0;                                                    \
+        }                                                              \
+      };                                                               \
+      _stz_impl_PROCEDURAL_STEPS(__VA_ARGS__)
+//*///------------------------------------------------------------------------------------------------------------------
+# undef  serialization_enum_range
+    constexpr int serialization_enum_range() noexcept { return 0; }
+# define serialization_enum_range(ENUM, MIN, MAX)                                         \
+      _seiriakos_impl::_enum_bounds<static_cast<long long>(MIN), static_cast<long long>(MAX)> \
+      friend _stz_impl_enum_range(ENUM) noexcept
+//*///------------------------------------------------------------------------------------------------------------------
+# undef  STZ_MAKE_ENUM_RANGE
+    constexpr int STZ_MAKE_ENUM_RANGE() noexcept { return 0; }
+# define STZ_MAKE_ENUM_RANGE(ENUM, MIN, MAX)                                                       \
+    namespace stz                                                                                 \
+    {                                                                                             \
+      inline namespace seiriakos                                                                  \
+      {                                                                                           \
+        template<>                                                                                \
+        struct enum_range<ENUM>                                                                   \
+          : _seiriakos_impl::_enum_bounds<static_cast<long long>(MIN), static_cast<long long>(MAX)> \
+        {};                                                                                       \
+      }                                                                                           \
+    }
 //*///------------------------------------------------------------------------------------------------------------------/*
 /*
 # define STZ_MAKE_SERIALIZATION(TYPE, ...)                                            \
@@ -2163,6 +6956,52 @@ inline namespace seiriakos
 
     return buffer.data();
   }
+//*///------------------------------------------------------------------------------------------------------------------
+  void flush_trace() noexcept
+  {
+# if defined(STZ_DEBUGGING)
+    _stz_impl_DECLARE_LOCK(_seiriakos_impl::_trace_mtx);
+
+    for (const auto& ring : _seiriakos_impl::_trace_rings)
+    {
+      const size_t published = ring->published.load(std::memory_order_acquire);
+
+      // offsets are relative to the top-level call the record belongs to
+      size_t base = 0;
+      for (size_t k = ring->head.load(std::memory_order_relaxed); k < published; ++k)
+      {
+        const auto& record = ring->records[k % _seiriakos_impl::_trace_ring::capacity];
+
+        if (record.depth == 0)
+        {
+          base = record.position;
+        }
+
+        _seiriakos_impl::_format_record(io::dbg, record, base);
+      }
+
+      ring->head.store(published, std::memory_order_release);
+
+      if (const size_t drops = ring->drops.exchange(0, std::memory_order_relaxed))
+      {
+        io::dbg << drops << " trace records dropped, the trace ring is full (STZ_TRACE_CAPACITY)\n";
+      }
+    }
+
+    io::dbg.flush();
+# endif
+  }
+//*///------------------------------------------------------------------------------------------------------------------
+  auto stats() noexcept -> Stats&
+  {
+# if defined(STZ_STATS)
+    return _seiriakos_impl::_stats;
+# else
+    // nothing counts into it, only there for the calls to stats() to compile
+    static _stz_impl_THREADLOCAL Stats zeros;
+    return zeros;
+# endif
+  }
 //*///------------------------------------------------------------------------------------------------------------------
 } /* namespace seiriakos */
 } /* namespace stz       */
@@ -2171,6 +7010,7 @@ inline namespace seiriakos
 #undef _stz_impl_CLANG_IGNORE
 #undef _stz_impl_GCC_IGNORE
 #undef _stz_impl_GCC_CLANG_IGNORE
+#undef _stz_impl_THREADSAFE
 #undef _stz_impl_THREADLOCAL
 #undef _stz_impl_ATOMIC
 #undef _stz_impl_DECLARE_MUTEX
@@ -2183,6 +7023,8 @@ inline namespace seiriakos
 #undef _stz_impl_NODISCARD_REASON
 #undef _stz_impl_IDEBUGGING
 #undef _stz_impl_DEBUGGING
+#undef _stz_impl_STATS
+#undef _stz_impl_REGROWTH
 #undef _stz_impl_WARNING
 #undef _stz_impl_CONSTEXPR_CPP14
 #undef _stz_impl_CONSTEXPR_CPP17